@@ -0,0 +1,167 @@
+#!/bin/bash
+#
+# Quality-versus-runtime regression runs: Corblivar is run w/ fixed seed and time budget for
+# each bench/config pair of the matrix file; the machine-readable reports of all runs
+# (see IO::writeReport) are gathered into one JSON-lines report, which is then compared
+# against the stored baseline
+#
+# Usage: regression.sh [update_baseline]
+#
+# Parameters may be overridden via environment variables, e.g., TIME_BUDGET=30 SEED=2
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+base=$root/exp
+binary=$root/Corblivar
+
+matrix=${MATRIX:-$base/regression/matrix}
+baseline=${BASELINE:-$base/regression/baseline.jsonl}
+report=${REPORT:-$root/build/regression/report.jsonl}
+runs_dir=$(dirname $report)
+
+seed=${SEED:-1}
+budget=${TIME_BUDGET:-60}
+# tolerated degradation, in percent
+moves_tolerance=${MOVES_TOLERANCE:-10}
+cost_tolerance=${COST_TOLERANCE:-5}
+# tolerated degradation of actual values of cost terms, in percent; all terms are to be
+# minimized; terms not given in both reports, i.e., not optimized, are skipped
+terms_tolerances="
+	packing_overhead:${PACKING_OVERHEAD_TOLERANCE:-10}
+	deadspace:${DEADSPACE_TOLERANCE:-10}
+	HPWL:${HPWL_TOLERANCE:-5}
+	TSVs:${TSVS_TOLERANCE:-10}
+	power:${POWER_TOLERANCE:-5}
+	routing_util:${ROUTING_UTIL_TOLERANCE:-10}
+	thermal:${THERMAL_TOLERANCE:-1}
+	alignments:${ALIGNMENTS_TOLERANCE:-10}
+	timing:${TIMING_TOLERANCE:-5}
+"
+
+# helper to extract value for key from JSON line
+value() {
+	echo "$1" | sed -n "s/.*\"$2\": \([^,}]*\).*/\1/p" | tr -d '"'
+}
+
+if [ ! -x $binary ]; then
+	echo "Corblivar binary missing; run make first!"
+	exit 1
+fi
+
+mkdir -p $runs_dir
+rm -f $report
+
+# perform runs
+#
+while read dies_config bench
+do
+	# skip comments and empty lines
+	if [ "$dies_config" == "" ] || [ "${dies_config:0:1}" == "#" ]; then
+		continue
+	fi
+
+	run_dir=$runs_dir/${dies_config//\//_}_$bench
+	mkdir -p $run_dir
+	cd $run_dir
+
+	echo "Run $bench w/ config $dies_config; seed $seed, time budget $budget s ..."
+
+	rm -f $bench"_report.json"
+	$binary $bench $base/configs/$dies_config/$bench.conf $base/benches/ --seed $seed --time-budget $budget > $bench.log
+
+	if [ -f $bench"_report.json" ]; then
+		sed "s|^{|{\"config\": \"$dies_config\", |" $bench"_report.json" >> $report
+	else
+		echo " Failure; see $run_dir/$bench.log"
+		echo "{\"config\": \"$dies_config\", \"benchmark\": \"$bench\", \"valid_solution\": false}" >> $report
+	fi
+
+	cd $root
+done < $matrix
+
+echo
+echo "Report: $report"
+
+# store new baseline, if requested
+#
+if [ "$1" == "update_baseline" ]; then
+	cp $report $baseline
+	echo "Baseline updated: $baseline"
+	exit 0
+fi
+
+if [ ! -f $baseline ]; then
+	echo "No baseline available; run \"$0 update_baseline\" to store the current report as baseline"
+	exit 0
+fi
+
+# compare against baseline
+#
+regressions=0
+
+echo
+printf "%-30s %-10s %12s %12s %12s %12s\n" "config" "bench" "moves/s" "(baseline)" "cost" "(baseline)"
+
+while read line
+do
+	config=$(value "$line" config)
+	bench=$(value "$line" benchmark)
+	ref=$(grep "\"config\": \"$config\", \"benchmark\": \"$bench\"" $baseline)
+
+	moves=$(value "$line" moves_per_s)
+	cost=$(value "$line" cost)
+	valid=$(value "$line" valid_solution)
+
+	if [ "$ref" == "" ]; then
+		printf "%-30s %-10s %12s %12s %12s %12s\n" $config $bench "$moves" "N/A" "$cost" "N/A"
+		continue
+	fi
+
+	ref_moves=$(value "$ref" moves_per_s)
+	ref_cost=$(value "$ref" cost)
+	ref_valid=$(value "$ref" valid_solution)
+
+	printf "%-30s %-10s %12s %12s %12s %12s\n" $config $bench "$moves" "$ref_moves" "$cost" "$ref_cost"
+
+	if [ "$ref_valid" == "true" ] && [ "$valid" != "true" ]; then
+		echo " REGRESSION: no valid solution anymore"
+		regressions=$((regressions + 1))
+		continue
+	fi
+
+	if awk -v c=$moves -v r=$ref_moves -v t=$moves_tolerance 'BEGIN {exit !(c < r * (1.0 - t / 100.0))}'; then
+		echo " REGRESSION: throughput dropped by more than $moves_tolerance %"
+		regressions=$((regressions + 1))
+	fi
+
+	if [ "$cost" != "null" ] && [ "$ref_cost" != "null" ] && [ "$ref_cost" != "" ]; then
+		if awk -v c=$cost -v r=$ref_cost -v t=$cost_tolerance 'BEGIN {exit !(c > r * (1.0 + t / 100.0))}'; then
+			echo " REGRESSION: cost increased by more than $cost_tolerance %"
+			regressions=$((regressions + 1))
+		fi
+	fi
+
+	for term_tolerance in $terms_tolerances
+	do
+		term=${term_tolerance%:*}
+		tolerance=${term_tolerance#*:}
+
+		term_value=$(value "$line" $term)
+		ref_term_value=$(value "$ref" $term)
+
+		if [ "$term_value" == "" ] || [ "$ref_term_value" == "" ]; then
+			continue
+		fi
+
+		if awk -v c=$term_value -v r=$ref_term_value -v t=$tolerance 'BEGIN {a = (r < 0) ? -r : r; exit !(c > r + a * t / 100.0)}'; then
+			echo " REGRESSION: $term increased by more than $tolerance %: $term_value (baseline: $ref_term_value)"
+			regressions=$((regressions + 1))
+		fi
+	done
+done < $report
+
+echo
+echo "Regressions: $regressions"
+
+if [ $regressions -gt 0 ]; then
+	exit 1
+fi
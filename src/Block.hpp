@@ -414,18 +414,31 @@ class Pin : public Block {
 		};
 };
 
-/// derived TSVs class; encapsulates TSV island / bundle of TSVs
-class TSV_Island : public Block {
+/// TSVs class; encapsulates TSV island / bundle of TSVs
+///
+/// note that islands are not derived from Block; they are generated anew for each layout
+/// evaluation and thus kept lightweight, i.e., w/o string ids and voltage data; names are
+/// only derived when writing output files, see IO::TSVIslandName
+class TSV_Island {
 	private:
 		/// debugging code switch (private)
 		static constexpr bool DBG = false;
 
+	// enum class for island type; has to be defined first
+	public:
+		/// origin of island; NET: signal TSV of single net, BUS: vertical bus
+		/// of alignment request, CLUSTER: clustered signal TSVs, DUMMY: dummy
+		/// thermal TSV
+		enum class Type : unsigned {NET, BUS, CLUSTER, DUMMY};
+
 	// constructors, destructors, if any non-implicit
 	//
 	public:
 		/// default constructor
-		TSV_Island (std::string const& id, int const& TSVs_count, double const& TSV_pitch, Rect const& bb, int const& layer, double width = -1.0) : Block(id) {
+		TSV_Island (Type const& type, int const& id, int const& TSVs_count, double const& TSV_pitch, Rect const& bb, int const& layer, double width = -1.0) {
 
+			this->type = type;
+			this->id = id;
 			this->TSVs_count = TSVs_count;
 			this->layer = layer;
 			this->bb = bb;
@@ -433,8 +446,25 @@ class TSV_Island : public Block {
 			this->resetOutline(TSV_pitch, width);
 		};
 
+		/// constructor for islands w/ already shaped outline, see resetOutline
+		TSV_Island (Type const& type, int const& id, int const& TSVs_count, Rect const& bb, int const& layer) {
+
+			this->type = type;
+			this->id = id;
+			this->TSVs_count = TSVs_count;
+			this->layer = layer;
+			this->bb = bb;
+		};
+
 	// public data, functions
 	public:
+		Type type;
+		/// numerical id, relates to type; NET: index of net, BUS: id of
+		/// alignment request, CLUSTER: index of cluster, DUMMY: index of frame
+		/// or bin
+		int id;
+		int layer;
+		Rect bb;
 		int TSVs_count;
 
 		/// limits for AR of TSV island
@@ -511,49 +541,175 @@ class TSV_Island : public Block {
 			if (TSV_Island::DBG) {
 
 				std::cout << "DBG_TSVS> TSV group" << std::endl;
-				std::cout << "DBG_TSVS>  " << this->id << std::endl;
+				std::cout << "DBG_TSVS>  " << this->type << " " << this->id << std::endl;
 				std::cout << "DBG_TSVS>  (" << this->bb.ll.x << "," << this->bb.ll.y << ")";
 				std::cout << "(" << this->bb.ur.x << "," << this->bb.ur.y << ")" << std::endl;
 			}
 		}
 
-		/// greedy shifting of new TSV island such that they don't overlap any
-		/// existing island
-		inline static void greedyShifting(TSV_Island& new_island_to_be_shifted, std::vector<TSV_Island> const& TSVs) {
-			bool shift = true;
+		/// spatial index of placed TSV islands, for greedy shifting; uniform grid
+		/// over the die outline for each layer, i.e., spatial hashing, where the
+		/// bins hold the indices of the islands in the related container; thus,
+		/// overlap checks are limited to nearby islands
+		class Index {
 
-			while (shift) {
+			// public data, functions
+			public:
+				/// grid dimension, for both x- and y-dimension
+				static constexpr int DIM = 32;
 
-				shift = false;
+				/// reset index; islands are to be indexed anew for the given
+				/// outline
+				inline void reset(Point const& outline) {
 
-				for (TSV_Island const& prev_island : TSVs) {
+					this->bin_w = outline.x / Index::DIM;
+					this->bin_h = outline.y / Index::DIM;
 
-					if (prev_island.layer != new_island_to_be_shifted.layer) {
-						continue;
+					for (auto& layer_bins : this->bins) {
+						for (std::vector<unsigned>& bin : layer_bins) {
+							bin.clear();
+						}
 					}
 
-					// sanity check, TSV islands considered for shifting shall be
-					// different ones
-					if (new_island_to_be_shifted.id == prev_island.id) {
-						continue;
-					}
+					this->indexed = 0;
+				};
+
+				/// index all islands of the container up to (excluding) the given
+				/// index; islands are indexed only once, i.e., their position is
+				/// considered fixed once indexed
+				inline void update(std::vector<TSV_Island> const& TSVs, unsigned const& end) {
 
-					if (Rect::rectsIntersect(prev_island.bb, new_island_to_be_shifted.bb)) {
+					for (; this->indexed < end; this->indexed++) {
 
-						// dbg logging for TSV island to be
-						// shifted
-						if (TSV_Island::DBG) {
-							std::cout << "DBG_TSVS> TSV island " << new_island_to_be_shifted.id << " to be shifted; overlaps with existing island " << prev_island.id << std::endl;
+						TSV_Island const& island = TSVs[this->indexed];
+
+						if (island.layer < 0) {
+							continue;
 						}
 
-						// shift only the new TSV
-						Rect::greedyShiftingRemoveIntersection(new_island_to_be_shifted.bb, prev_island.bb);
+						if (static_cast<unsigned>(island.layer) >= this->bins.size()) {
+							this->bins.resize(island.layer + 1, std::vector< std::vector<unsigned> >(Index::DIM * Index::DIM));
+						}
+
+						for (int x = this->binX(island.bb.ll.x); x <= this->binX(island.bb.ur.x); x++) {
+							for (int y = this->binY(island.bb.ll.y); y <= this->binY(island.bb.ur.y); y++) {
+								this->bins[island.layer][x * Index::DIM + y].push_back(this->indexed);
+							}
+						}
+					}
+				};
 
-						shift = true;
-						break;
+				/// first indexed island, i.e., w/ lowest index, which overlaps
+				/// the given island; -1 for none
+				inline int firstOverlap(TSV_Island const& island, std::vector<TSV_Island> const& TSVs) const {
+					int ret = -1;
+
+					if (island.layer < 0 || static_cast<unsigned>(island.layer) >= this->bins.size()) {
+						return ret;
+					}
+
+					for (int x = this->binX(island.bb.ll.x); x <= this->binX(island.bb.ur.x); x++) {
+						for (int y = this->binY(island.bb.ll.y); y <= this->binY(island.bb.ur.y); y++) {
+
+							for (unsigned const& i : this->bins[island.layer][x * Index::DIM + y]) {
+
+								if ((ret == -1 || static_cast<int>(i) < ret) && Rect::rectsIntersect(TSVs[i].bb, island.bb)) {
+									ret = i;
+								}
+							}
+						}
 					}
+
+					return ret;
+				};
+
+				/// getter
+				inline unsigned const& size() const {
+					return this->indexed;
+				};
+
+			// private data, functions
+			private:
+				/// bins; outer vector: layers; inner vectors: bins, each w/
+				/// indices of islands
+				std::vector< std::vector< std::vector<unsigned> > > bins;
+				/// bin dimensions
+				double bin_w = 1.0, bin_h = 1.0;
+				/// count of indexed islands, i.e., the first islands of the
+				/// container
+				unsigned indexed = 0;
+
+				/// bin for coordinate; coordinates beyond the outline are
+				/// mapped into the border bins
+				inline int binX(double const& x) const {
+					return std::max(0, std::min(Index::DIM - 1, static_cast<int>(x / this->bin_w)));
+				};
+				/// bin for coordinate; coordinates beyond the outline are
+				/// mapped into the border bins
+				inline int binY(double const& y) const {
+					return std::max(0, std::min(Index::DIM - 1, static_cast<int>(y / this->bin_h)));
+				};
+		};
+
+		/// greedy shifting of new TSV island such that they don't overlap any
+		/// existing island
+		///
+		/// the island to be shifted is either not part of the container yet, or
+		/// it is the last island of the container; all other islands are
+		/// considered via the spatial index, which is updated accordingly; note
+		/// that each island can trigger at most one shift since shifting is
+		/// strictly upwards or to the right, see
+		/// Rect::greedyShiftingRemoveIntersection; the iterations are thus
+		/// bounded by the count of islands
+		inline static void greedyShifting(TSV_Island& new_island_to_be_shifted, std::vector<TSV_Island> const& TSVs, Index& index) {
+			int prev_island;
+			unsigned iterations;
+
+			// index all other islands
+			if (!TSVs.empty() && &TSVs.back() == &new_island_to_be_shifted) {
+				index.update(TSVs, TSVs.size() - 1);
+			}
+			else {
+				index.update(TSVs, TSVs.size());
+			}
+
+			iterations = 0;
+
+			while ((prev_island = index.firstOverlap(new_island_to_be_shifted, TSVs)) != -1 && iterations <= index.size()) {
+
+				// dbg logging for TSV island to be
+				// shifted
+				if (TSV_Island::DBG) {
+					std::cout << "DBG_TSVS> TSV island " << new_island_to_be_shifted.type << " " << new_island_to_be_shifted.id;
+					std::cout << " to be shifted; overlaps with existing island " << TSVs[prev_island].type << " " << TSVs[prev_island].id << std::endl;
 				}
+
+				// shift only the new TSV
+				Rect::greedyShiftingRemoveIntersection(new_island_to_be_shifted.bb, TSVs[prev_island].bb);
+
+				iterations++;
+			}
+		}
+
+		friend std::ostream& operator<< (std::ostream& out, Type const& type) {
+
+			switch (type) {
+
+				case Type::NET:
+					out << "net";
+					break;
+				case Type::BUS:
+					out << "bus";
+					break;
+				case Type::CLUSTER:
+					out << "net_cluster";
+					break;
+				case Type::DUMMY:
+					out << "dummy";
+					break;
 			}
+
+			return out;
 		}
 };
 
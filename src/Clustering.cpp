@@ -36,13 +36,14 @@
 /// results, and 3) perform the thermal analysis again, w/ consideration of TSVs.)
 // TODO according to valgrind/callgrind, the efforts for thermal analysis are around 8%, whereas the efforts for determineHotspots are 30%; thus, we could also allow for the
 // additional efforts for another run of thermal analysis
-void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vector<Segments> > &nets_segments, std::vector<TSV_Island> &TSVs, double const& TSV_pitch, unsigned const& upper_limit_TSVs, ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis) {
+void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vector<Segments> > &nets_segments, std::vector<TSV_Island> &TSVs, TSV_Island::Index &TSVs_index, double const& TSV_pitch, unsigned const& upper_limit_TSVs, ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis) {
 	unsigned i, j;
 	std::vector<Segments>::iterator it_seg;
 	std::list<Net*>::iterator it_net;
 	Rect intersection, cluster;
 	bool all_clustered;
 	std::list<Cluster>::iterator it_cluster;
+	int cluster_id;
 
 	if (Clustering::DBG) {
 		std::cout << "-> Clustering::clusterSignalTSVs(" << &nets << ", " << &nets_segments << ", " << &thermal_analysis << ")" << std::endl;
@@ -259,11 +260,13 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 		// also link TSVs (blocks) to the respective nets; this is required for
 		// more accurate wirelength estimation
 		//
-		for (it_cluster = this->clusters[i].begin(); it_cluster != this->clusters[i].end(); ++it_cluster) {
+		cluster_id = 0;
+		for (it_cluster = this->clusters[i].begin(); it_cluster != this->clusters[i].end(); ++it_cluster, cluster_id++) {
 
 			TSV_Island TSVi = TSV_Island(
-					// cluster id
-					"net_cluster_" + std::to_string((*it_cluster).nets.size()),
+					// cluster island, w/ index of cluster as id
+					TSV_Island::Type::CLUSTER,
+					cluster_id,
 					// signal / TSV count
 					(*it_cluster).nets.size(),
 					// TSV pitch; required for proper scaling
@@ -282,7 +285,7 @@ void Clustering::clusterSignalTSVs(std::vector<Net> &nets, std::vector< std::vec
 			// perform greedy shifting in case new island overlaps with any
 			// previous one
 			//
-			TSV_Island::greedyShifting(TSVi, TSVs);
+			TSV_Island::greedyShifting(TSVi, TSVs, TSVs_index);
 
 			// store in global TSVs container
 			TSVs.push_back(TSVi);
@@ -80,6 +80,7 @@ class Clustering {
 		void clusterSignalTSVs(std::vector<Net> &nets,
 				std::vector< std::vector<Segments> > &nets_segments,
 				std::vector<TSV_Island> &TSVs,
+				TSV_Island::Index &TSVs_index,
 				double const& TSV_pitch,
 				unsigned const& upper_limit_TSVs,
 				ThermalAnalyzer::ThermalAnalysisResult &thermal_analysis);
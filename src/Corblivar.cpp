@@ -56,8 +56,44 @@ int main (int argc, char** argv) {
 	// init routing-utilization analyzer
 	fp.initRoutingUtilAnalyzer();
 
+	// warm start; read in solution file and refine it
+	if (fp.warmStart()) {
+
+		if (fp.logMin()) {
+			std::cout << "Corblivar> ";
+			std::cout << "Handling given solution file for warm start ..." << std::endl << std::endl;
+		}
+
+		// read from file
+		IO::parseCorblivarFile(fp, corb);
+
+		// assume read in data as currently best solution, in case the
+		// refinement finds no better solution fitting into the outline
+		corb.storeBestCBLs();
+
+		if (fp.logMin()) {
+			std::cout << "Corblivar> ";
+			std::cout << "Performing SA refinement ..." << std::endl << std::endl;
+		}
+
+		// perform SA; refinement handler
+		done = fp.performRefinementSA(corb);
+
+		if (fp.logMin()) {
+			std::cout << "Corblivar> ";
+			if (done) {
+				std::cout << "Done, refinement was successful" << std::endl << std::endl;
+			}
+			else {
+				std::cout << "Done, refinement was _not_ successful; consider the solution file as is" << std::endl << std::endl;
+			}
+		}
+
+		// finalize: generate output files, final logging
+		fp.finalize(corb);
+	}
 	// non-regular run; read in solution file
-	if (fp.inputSolutionFileOpen()) {
+	else if (fp.inputSolutionFileOpen()) {
 
 		if (fp.logMin()) {
 			std::cout << "Corblivar> ";
@@ -76,16 +112,16 @@ int main (int argc, char** argv) {
 	}
 	// regular run; perform floorplanning
 	else {
-		// generate new, random data set
-		corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+		// generate new data set
+		fp.initCorblivar(corb);
 
 		if (fp.logMin()) {
 			std::cout << "Corblivar> ";
 			std::cout << "Performing SA floorplanning optimization ..." << std::endl << std::endl;
 		}
 
-		// perform SA; main handler
-		done = fp.performSA(corb);
+		// perform SA; main handler, covers multilevel and flat SA
+		done = fp.performMultilevelSA(corb);
 
 		if (fp.logMin()) {
 			std::cout << "Corblivar> ";
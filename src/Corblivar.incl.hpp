@@ -38,8 +38,15 @@
 #include <bitset>
 #include <utility>
 #include <algorithm>
-// (TODO) replace w/ chrono
-#include <sys/timeb.h>
+#include <chrono>
+#include <random>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+// creation of output directories
+#include <sys/stat.h>
 
 // C libaries
 // (TODO) replace w/ STL where possible
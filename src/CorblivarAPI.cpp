@@ -0,0 +1,318 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar embeddable API; in-memory designs, floorplanning and
+ *    evaluation w/o file IO
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// own Corblivar header
+#include "CorblivarAPI.hpp"
+// required Corblivar headers
+#include "CorblivarCore.hpp"
+#include "FloorPlanner.hpp"
+#include "IO.hpp"
+
+CorblivarAPI::CorblivarAPI(std::string const& name, std::string const& config_file) {
+	this->name = name;
+	this->config_file = config_file;
+	this->log = 0;
+}
+
+CorblivarAPI::~CorblivarAPI() {
+}
+
+void CorblivarAPI::addBlock(BlockSpec const& block) {
+	this->blocks.push_back(block);
+	this->fp.reset();
+}
+
+void CorblivarAPI::addTerminal(TerminalSpec const& terminal) {
+	this->terminals.push_back(terminal);
+	this->fp.reset();
+}
+
+void CorblivarAPI::addNet(NetSpec const& net) {
+	this->nets.push_back(net);
+	this->fp.reset();
+}
+
+void CorblivarAPI::addAlignment(AlignmentSpec const& alignment) {
+	this->alignments.push_back(alignment);
+	this->fp.reset();
+}
+
+void CorblivarAPI::setParameter(std::string const& name, std::string const& value) {
+	this->parameters.push_back({name, value});
+	this->fp.reset();
+}
+
+void CorblivarAPI::setLog(int const& log) {
+	this->log = log;
+	this->fp.reset();
+}
+
+/// floorplanning; each SA run starts from a new setup of the design, such that runs w/
+/// fixed seed are reproducible and match those of the Corblivar binary
+CorblivarAPI::Result CorblivarAPI::optimize() {
+
+	if (CorblivarAPI::DBG) {
+		std::cout << "-> CorblivarAPI::optimize()" << std::endl;
+	}
+
+	this->setup();
+
+	// generate new data set
+	this->fp->initCorblivar(*this->corb);
+
+	// perform SA; main handler, covers multilevel and flat SA
+	this->fp->performMultilevelSA(*this->corb);
+
+	if (CorblivarAPI::DBG) {
+		std::cout << "<- CorblivarAPI::optimize" << std::endl;
+	}
+
+	return this->result(true);
+}
+
+/// evaluation; reuses the current setup of the design, if any, since all blocks' shapes
+/// and dies are defined by the CBLs
+CorblivarAPI::Result CorblivarAPI::evaluate(std::string const& CBLs) {
+	std::istringstream CBLs_in(CBLs);
+
+	if (CorblivarAPI::DBG) {
+		std::cout << "-> CorblivarAPI::evaluate(" << CBLs.size() << ")" << std::endl;
+	}
+
+	if (!this->fp) {
+		this->setup();
+	}
+
+	// reset CBLs, e.g., of previous runs
+	for (int d = 0; d < this->fp->getLayers(); d++) {
+		this->corb->editDie(d).editCBL().clear();
+	}
+
+	// read from in-memory data
+	IO::parseCorblivarFile(*this->fp, *this->corb, CBLs_in);
+
+	// assume read in data as best solution
+	this->corb->storeBestCBLs();
+
+	if (CorblivarAPI::DBG) {
+		std::cout << "<- CorblivarAPI::evaluate" << std::endl;
+	}
+
+	// overall cost cannot be determined since no normalization during SA search was
+	// performed
+	return this->result(false);
+}
+
+/// setup; same sequence as in main() of Corblivar, w/ in-memory data instead of
+/// benchmark files
+void CorblivarAPI::setup() {
+	std::stringstream blocks_in, pins_in, power_in, nets_in, alignments_in;
+
+	this->fp.reset(new FloorPlanner());
+	FloorPlanner& fp = *this->fp;
+
+	// design properties, as determined for benchmark files in
+	// IO::parseParametersFiles
+	fp.benchmark = this->name;
+	fp.thermal_analyser_run = false;
+	fp.IO_conf.GT_benchmark = false;
+	fp.IO_conf.alignments_file_avail = !this->alignments.empty();
+	fp.IO_conf.power_density_file_avail = std::any_of(this->blocks.begin(), this->blocks.end(),
+			[](BlockSpec const& block) {
+				return block.power_density != 0.0;
+			});
+
+	// parameters
+	IO::initNamedParameters(fp);
+	for (std::pair<std::string, std::string> const& parameter : this->parameters) {
+		IO::parseNamedParameter(fp, parameter.first, parameter.second);
+	}
+
+	// fixed seed, overrides the time-based seed of FloorPlanner
+	if (fp.schedule.fixed_seed) {
+		Math::seed(fp.schedule.seed);
+	}
+
+	// parse config and technology files; log level of config file is overridden
+	fp.log = this->log;
+	IO::parseConfigFiles(fp, this->config_file, 0.0, this->log);
+
+	// design as in-memory data
+	this->writeDesign(blocks_in, pins_in, power_in, nets_in, alignments_in);
+
+	// parse blocks
+	IO::parseBlocks(fp, blocks_in, pins_in, power_in);
+	// parse nets
+	IO::parseNets(fp, nets_in);
+
+	// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+	fp.initTimingPowerAnalyser();
+
+	// init Corblivar core
+	this->corb.reset(new CorblivarCore(fp.getLayers(), fp.getBlocks().size()));
+
+	// parse alignment request
+	if (fp.IO_conf.alignments_file_avail) {
+		IO::parseAlignmentRequests(fp, this->corb->editAlignments(), alignments_in);
+	}
+
+	// init thermal analyzer, only reasonable after parsing config file
+	fp.initThermalAnalyzer();
+
+	// init routing-utilization analyzer
+	fp.initRoutingUtilAnalyzer();
+}
+
+/// GSRC-style data, as parsed by IO::parseBlocks, IO::parseNets, and
+/// IO::parseAlignmentRequests
+void CorblivarAPI::writeDesign(std::ostream& blocks_out, std::ostream& pins_out, std::ostream& power_out, std::ostream& nets_out, std::ostream& alignments_out) const {
+	unsigned soft_blocks, pins_count;
+
+	// full precision of dimensions and coordinates
+	blocks_out << std::setprecision(std::numeric_limits<double>::max_digits10);
+	pins_out << std::setprecision(std::numeric_limits<double>::max_digits10);
+	power_out << std::setprecision(std::numeric_limits<double>::max_digits10);
+	alignments_out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+	// blocks and terminal pins
+	soft_blocks = std::count_if(this->blocks.begin(), this->blocks.end(),
+			[](BlockSpec const& block) {
+				return block.soft;
+			});
+
+	blocks_out << "NumSoftRectangularBlocks : " << soft_blocks << std::endl;
+	blocks_out << "NumHardRectilinearBlocks : " << this->blocks.size() - soft_blocks << std::endl;
+	blocks_out << "NumTerminals : " << this->terminals.size() << std::endl;
+
+	for (BlockSpec const& block : this->blocks) {
+
+		if (block.soft) {
+			blocks_out << block.id << " softrectangular " << block.w * block.h << " " << block.AR_min << " " << block.AR_max << std::endl;
+		}
+		else {
+			blocks_out << block.id << " hardrectilinear 4 (0, 0) (0, " << block.h << ") (" << block.w << ", " << block.h << ") (" << block.w << ", 0)" << std::endl;
+		}
+
+		// power densities are expected in the very same order as blocks; the
+		// header is terminated by ``end''
+		power_out << block.power_density << std::endl;
+	}
+
+	for (TerminalSpec const& terminal : this->terminals) {
+		blocks_out << terminal.id << " terminal" << std::endl;
+		pins_out << terminal.id << " " << terminal.x << " " << terminal.y << std::endl;
+	}
+
+	// nets
+	pins_count = 0;
+	for (NetSpec const& net : this->nets) {
+		pins_count += net.pins.size();
+	}
+
+	nets_out << "NumNets : " << this->nets.size() << std::endl;
+	nets_out << "NumPins : " << pins_count << std::endl;
+
+	for (NetSpec const& net : this->nets) {
+
+		nets_out << "NetDegree : " << net.pins.size() << std::endl;
+
+		for (std::string const& pin : net.pins) {
+			nets_out << pin << " B" << std::endl;
+		}
+	}
+
+	// alignment requests
+	alignments_out << "data_start" << std::endl;
+
+	for (AlignmentSpec const& req : this->alignments) {
+		alignments_out << "( " << req.handling << " " << req.signals << " " << req.block_1 << " " << req.block_2 << " ";
+		alignments_out << req.type_x << " " << req.alignment_x << " " << req.type_y << " " << req.alignment_y << " )" << std::endl;
+	}
+}
+
+/// final layout and evaluation, as in FloorPlanner::finalize; however, the die outline
+/// is not shrunk, such that further evaluations consider the same outline
+CorblivarAPI::Result CorblivarAPI::result(bool const& overall_cost) {
+	FloorPlanner& fp = *this->fp;
+	FloorPlanner::Cost cost;
+	Point blocks_outline;
+	bool solution_avail;
+	Result ret;
+
+	// apply best solution, if available, as final solution
+	solution_avail = this->corb->applyBestCBLs(fp.logMin());
+	// generate final layout
+	fp.generateLayout(*this->corb, fp.opt_flags.alignment);
+
+	ret.valid = false;
+	ret.cost = std::numeric_limits<double>::quiet_NaN();
+	ret.packing_overhead = ret.deadspace = ret.die_w = ret.die_h = ret.HPWL = ret.TSVs = ret.power = 0.0;
+	ret.routing_util = ret.thermal = ret.alignments = ret.timing = 0.0;
+
+	// determine cost terms and overall cost; consider non-normalized, actual values
+	if (solution_avail) {
+
+		// the layout is valid only if it fits into the fixed outline
+		blocks_outline = fp.determBlocksOutline();
+		ret.valid = (blocks_outline.x <= fp.IC.outline_x && blocks_outline.y <= fp.IC.outline_y);
+
+		// scale terminal pins to blocks outline, as for best solutions during SA;
+		// this way, evaluations are independent of previous runs
+		fp.scaleTerminalPins(blocks_outline);
+
+		cost = fp.evaluateLayout(this->corb->getAlignments(), 1.0, true, false, true);
+
+		if (overall_cost) {
+			ret.cost = cost.total_cost;
+		}
+		ret.packing_overhead = cost.area_actual_value;
+		ret.deadspace = 100.0 * (fp.IC.stack_deadspace / fp.IC.stack_area);
+		ret.die_w = fp.IC.outline_x;
+		ret.die_h = fp.IC.outline_y;
+		ret.HPWL = cost.HPWL_actual_value;
+		ret.TSVs = cost.TSVs_actual_value;
+		ret.power = cost.power_blocks + cost.power_wires + cost.power_TSVs;
+
+		if (fp.opt_flags.routing_util) {
+			ret.routing_util = cost.routing_util_actual_value;
+		}
+		if (fp.opt_flags.thermal) {
+			ret.thermal = cost.thermal_actual_value;
+		}
+		if (fp.opt_flags.alignment) {
+			ret.alignments = cost.alignments_actual_value;
+		}
+		if (fp.opt_flags.timing || fp.opt_flags.voltage_assignment) {
+			ret.timing = cost.timing_actual_value;
+		}
+	}
+
+	for (Block const& block : fp.getBlocks()) {
+		ret.blocks.push_back({block.id, block.layer, block.bb.ll.x, block.bb.ll.y, block.bb.w, block.bb.h});
+	}
+
+	ret.CBLs = this->corb->CBLsString();
+
+	return ret;
+}
@@ -0,0 +1,170 @@
+/**
+ * =====================================================================================
+ *
+ *    Description:  Corblivar embeddable API; in-memory designs, floorplanning and
+ *    evaluation w/o file IO
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_API
+#define _CORBLIVAR_API
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+//
+// forward declarations, if any
+class FloorPlanner;
+class CorblivarCore;
+
+/// Corblivar embeddable API, to be linked via libcorblivar.a; a design is constructed in
+/// memory and handed to the regular parsers as GSRC-style in-memory data, such that all
+/// the sanity checks and the scaling of blocks, power, and terminal pins apply as for
+/// benchmark files. Config and technology parameters are parsed from the config file;
+/// errors terminate the process, as for the Corblivar binary.
+class CorblivarAPI {
+	private:
+		/// debugging code switch (private)
+		static constexpr bool DBG = false;
+
+	// public data, functions
+	public:
+		/// POD for blocks; hard blocks are defined by width and height, soft
+		/// blocks by their area, i.e., w * h, and their range of aspect ratios;
+		/// dimensions in [um], scaled as defined in the technology file
+		struct BlockSpec {
+			std::string id;
+			double w, h;
+			bool soft;
+			double AR_min, AR_max;
+			/// power density [uW/um^2]; if no block has a power density
+			/// assigned, thermal analysis is deactivated
+			double power_density;
+		};
+		/// POD for terminal pins; coordinates are scaled such that the pins
+		/// spread the die outline, as for GSRC pl files
+		struct TerminalSpec {
+			std::string id;
+			double x, y;
+		};
+		/// POD for nets; ids of blocks and terminal pins, where a terminal pin
+		/// given first marks an input net
+		struct NetSpec {
+			std::vector<std::string> pins;
+		};
+		/// POD for alignment requests; syntax of handling and types as for
+		/// alignment-requests files, i.e., STRICT or FLEXIBLE, and MIN, MAX,
+		/// OFFSET, or UNDEF
+		struct AlignmentSpec {
+			std::string handling;
+			int signals;
+			std::string block_1, block_2;
+			std::string type_x;
+			double alignment_x;
+			std::string type_y;
+			double alignment_y;
+		};
+
+		/// POD for blocks in the resulting layout
+		struct BlockGeometry {
+			std::string id;
+			int layer;
+			double x, y, w, h;
+		};
+		/// POD for results; actual values, as for the report of the Corblivar
+		/// binary
+		struct Result {
+			/// evaluated layout fits into the fixed outline, i.e., its blocks
+			/// outline is within the die outline
+			bool valid;
+			/// overall cost; only determined by SA runs, NaN for evaluations
+			/// of given CBLs
+			double cost;
+			/// cost terms and further criteria
+			double packing_overhead, deadspace, die_w, die_h, HPWL, TSVs, power;
+			/// cost terms and further criteria; zero if not optimized
+			double routing_util, thermal, alignments, timing;
+			/// blocks of layout
+			std::vector<BlockGeometry> blocks;
+			/// CBLs of layout, in the syntax of solution files
+			std::string CBLs;
+		};
+
+		/// design; blocks
+		void addBlock(BlockSpec const& block);
+		/// design; terminal pins
+		void addTerminal(TerminalSpec const& terminal);
+		/// design; nets
+		void addNet(NetSpec const& net);
+		/// design; alignment requests
+		void addAlignment(AlignmentSpec const& alignment);
+
+		/// parameters; optional named parameters of the Corblivar binary, e.g.,
+		/// ``--seed'', ``--time-budget'', or ``--multilevel''; parameters
+		/// handling further files are not reasonable here
+		void setParameter(std::string const& name, std::string const& value);
+		/// parameters; log level, overrides the value of the config file;
+		/// default: 0, i.e., no logging
+		void setLog(int const& log);
+
+		/// floorplanning; SA run, as for the Corblivar binary
+		Result optimize();
+		/// evaluation of given CBLs, in the syntax of solution files
+		Result evaluate(std::string const& CBLs);
+
+	// constructors, destructors, if any non-implicit
+	public:
+		/// design name, i.e., benchmark name, and config file
+		CorblivarAPI(std::string const& name, std::string const& config_file);
+		/// destructor; required for forward-declared members
+		~CorblivarAPI();
+
+	// private data, functions
+	private:
+		/// design
+		std::string name, config_file;
+		/// design
+		std::vector<BlockSpec> blocks;
+		/// design
+		std::vector<TerminalSpec> terminals;
+		/// design
+		std::vector<NetSpec> nets;
+		/// design
+		std::vector<AlignmentSpec> alignments;
+
+		/// parameters
+		std::vector< std::pair<std::string, std::string> > parameters;
+		/// parameters
+		int log;
+
+		/// floorplanner and Corblivar core, setup from the design on demand;
+		/// reset for any change of design or parameters
+		std::unique_ptr<FloorPlanner> fp;
+		/// floorplanner and Corblivar core, setup from the design on demand;
+		/// reset for any change of design or parameters
+		std::unique_ptr<CorblivarCore> corb;
+
+		/// setup helper; parse config files and design, init analyzers
+		void setup();
+		/// setup helper; design as GSRC-style in-memory data
+		void writeDesign(std::ostream& blocks_out, std::ostream& pins_out, std::ostream& power_out, std::ostream& nets_out, std::ostream& alignments_out) const;
+		/// result helper; final layout and evaluation, w/o output files
+		Result result(bool const& overall_cost);
+};
+
+#endif
@@ -32,6 +32,21 @@ CorblivarAlignmentReq::Evaluate CorblivarAlignmentReq::evaluate() const {
 	Rect blocks_intersect;
 	Evaluate ret;
 
+	// neither the blocks nor the request itself have changed since the previous
+	// evaluation; restore the related results
+	if (this->cache.valid &&
+			Rect::identical(this->cache.bb_i, this->s_i->bb) && Rect::identical(this->cache.bb_j, this->s_j->bb) &&
+			this->cache.type_x == this->type_x && this->cache.type_y == this->type_y &&
+			this->cache.alignment_x == this->alignment_x && this->cache.alignment_y == this->alignment_y
+	   ) {
+
+		this->fulfilled = this->cache.fulfilled;
+		this->s_i->alignment = this->cache.alignment_i;
+		this->s_j->alignment = this->cache.alignment_j;
+
+		return this->cache.eval;
+	}
+
 	// initially, assume zero cost / alignment mismatch
 	ret.cost = 0.0;
 
@@ -344,6 +359,19 @@ CorblivarAlignmentReq::Evaluate CorblivarAlignmentReq::evaluate() const {
 	// weight the cost w/ signals count
 	ret.cost *= this->signals;
 
+	// memorize evaluation
+	this->cache.valid = true;
+	this->cache.bb_i = this->s_i->bb;
+	this->cache.bb_j = this->s_j->bb;
+	this->cache.type_x = this->type_x;
+	this->cache.type_y = this->type_y;
+	this->cache.alignment_x = this->alignment_x;
+	this->cache.alignment_y = this->alignment_y;
+	this->cache.eval = ret;
+	this->cache.fulfilled = this->fulfilled;
+	this->cache.alignment_i = this->s_i->alignment;
+	this->cache.alignment_j = this->s_j->alignment;
+
 	// dbg logging for alignment
 	if (CorblivarAlignmentReq::DBG_EVALUATE) {
 
@@ -103,6 +103,25 @@ class CorblivarAlignmentReq {
 			double actual_mismatch;
 		};
 
+		/// cache of the most recent evaluation; keyed by the blocks' geometry and
+		/// the request's alignment, such that only requests w/ moved or reshaped
+		/// blocks are re-evaluated; also holds the (not yet shifted) TSV island
+		/// derived for the most recent blocks' intersection
+		mutable struct Cache {
+			bool valid = false;
+			Rect bb_i, bb_j;
+			Type type_x, type_y;
+			double alignment_x, alignment_y;
+			Evaluate eval;
+			bool fulfilled;
+			Block::AlignmentStatus alignment_i, alignment_j;
+
+			bool island_valid = false;
+			Rect intersect;
+			double island_width;
+			Rect island_bb;
+		} cache;
+
 		friend std::ostream& operator<< (std::ostream& out, Type const& type) {
 
 			switch (type) {
@@ -26,6 +26,7 @@
 // required Corblivar headers
 #include "Math.hpp"
 #include "Block.hpp"
+#include "Net.hpp"
 
 // memory allocation
 constexpr int CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE;
@@ -139,6 +140,585 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, st
 	}
 }
 
+void CorblivarCore::initCorblivarPartitioned(bool const& log, int const& layers, std::vector<Block> const& blocks, std::vector<Net> const& nets,
+		bool const& power_aware_assignment) {
+	std::vector< std::vector<unsigned> > nets_blocks, blocks_nets;
+	std::vector<unsigned> all_blocks;
+	std::vector<int> blocks_dies;
+	unsigned b;
+	Direction cur_dir;
+	int die;
+
+	if (log) {
+		std::cout << "Corblivar> ";
+		std::cout << "Initializing Corblivar data for corb on " << layers << " layers; ";
+		if (power_aware_assignment) {
+			std::cout << "w/ min-cut partitioning and power-aware block handling..." << std::endl;
+		}
+		else {
+			std::cout << "w/ min-cut partitioning..." << std::endl;
+		}
+	}
+
+	// hypergraph of nets; blocks connected multiple times to one net are considered
+	// only once
+	blocks_nets.resize(blocks.size());
+
+	for (Net const& cur_net : nets) {
+
+		nets_blocks.emplace_back();
+
+		for (Block const* cur_block : cur_net.blocks) {
+
+			b = cur_block - blocks.data();
+
+			if (std::find(nets_blocks.back().begin(), nets_blocks.back().end(), b) == nets_blocks.back().end()) {
+				nets_blocks.back().push_back(b);
+				blocks_nets[b].push_back(nets_blocks.size() - 1);
+			}
+		}
+	}
+
+	// recursive bisection into dies
+	for (b = 0; b < blocks.size(); b++) {
+		all_blocks.push_back(b);
+	}
+	blocks_dies.assign(blocks.size(), 0);
+
+	CorblivarCore::partitionBlocks(all_blocks, 0, layers, blocks, nets_blocks, blocks_nets, power_aware_assignment, blocks_dies);
+
+	// for power-aware assignment, the dies are already ordered by the power
+	// densities of their blocks, ascending as for initCorblivarRandomly, see
+	// bisectBlocks
+
+	// generate tuples, in order of the blocks
+	for (b = 0; b < blocks.size(); b++) {
+
+		die = blocks_dies[b];
+
+		// memorize layer in block itself
+		blocks[b].layer = die;
+
+		// generate direction L
+		if (Math::randB()) {
+			cur_dir = Direction::HORIZONTAL;
+		}
+		else {
+			cur_dir = Direction::VERTICAL;
+		}
+
+		// store into separate CBL sequences; T-junctions are initialized as
+		// zero, see initCorblivarRandomly
+		this->dies[die].CBL.S.push_back(&blocks[b]);
+		this->dies[die].CBL.L.push_back(std::move(cur_dir));
+		this->dies[die].CBL.T.push_back(0);
+	}
+
+	if (CorblivarCore::DBG) {
+		for (CorblivarDie const& die : this->dies) {
+			std::cout << "DBG_CORE> ";
+			std::cout << "Init CBL tuples for die " << die.id + 1 << "; " << die.CBL.size() << " tuples:" << std::endl;
+			std::cout << die.CBL.CBLString() << std::endl;
+			std::cout << "DBG_CORE> ";
+			std::cout << std::endl;
+		}
+	}
+
+	if (log) {
+		std::cout << "Corblivar> ";
+		std::cout << "Done" << std::endl << std::endl;
+	}
+}
+
+/// analytical placement: quadratic placement of all blocks, w/ clique model for nets
+/// and terminal pins as fixed anchors; solved by Jacobi-preconditioned conjugate
+/// gradients, separately for x- and y-coordinates; all blocks are additionally
+/// anchored weakly to the die center, which avoids singular systems for blocks w/o
+/// (transitive) connection to terminal pins
+///
+/// the coordinates are converted into CBLs, separately for each die: the tuples are
+/// ordered by the blocks' distance to the lower left corner, and blocks are inserted
+/// horizontally, i.e., to the right, if they are placed rather right than top, and
+/// vertically otherwise; T-junctions are reset to zero
+void CorblivarCore::orderCBLsByPlacement(bool const& log, std::vector<Block> const& blocks, std::vector<Net> const& nets, Point const& outline) {
+	std::vector< std::unordered_map<unsigned, double> > weights;
+	std::vector<double> diag;
+	std::vector< std::array<double, 2> > rhs, coords;
+	std::vector<CornerBlockList::Tuple> tuples_die;
+	std::vector<unsigned> net_blocks;
+	double weight;
+	unsigned b;
+
+	if (log) {
+		std::cout << "Corblivar> ";
+		std::cout << "Ordering CBL tuples by analytical placement ..." << std::endl;
+	}
+
+	// system of equations; off-diagonal weights, diagonal, and right-hand sides
+	weights.resize(blocks.size());
+	diag.assign(blocks.size(), CorblivarCore::PLACEMENT_ANCHOR_WEIGHT);
+	rhs.assign(blocks.size(), {{CorblivarCore::PLACEMENT_ANCHOR_WEIGHT * outline.x / 2.0, CorblivarCore::PLACEMENT_ANCHOR_WEIGHT * outline.y / 2.0}});
+
+	for (Net const& cur_net : nets) {
+
+		net_blocks.clear();
+		for (Block const* cur_block : cur_net.blocks) {
+
+			b = cur_block - blocks.data();
+
+			if (std::find(net_blocks.begin(), net_blocks.end(), b) == net_blocks.end()) {
+				net_blocks.push_back(b);
+			}
+		}
+
+		// large nets, e.g., clock nets, hardly indicate placement preferences
+		if (net_blocks.size() + cur_net.terminals.size() < 2 || net_blocks.size() > CorblivarCore::PLACEMENT_NET_DEGREE_MAX) {
+			continue;
+		}
+
+		weight = 1.0 / (net_blocks.size() + cur_net.terminals.size() - 1);
+
+		for (unsigned i = 0; i < net_blocks.size(); i++) {
+
+			for (unsigned j = i + 1; j < net_blocks.size(); j++) {
+				weights[net_blocks[i]][net_blocks[j]] += weight;
+				weights[net_blocks[j]][net_blocks[i]] += weight;
+				diag[net_blocks[i]] += weight;
+				diag[net_blocks[j]] += weight;
+			}
+
+			for (Pin const* pin : cur_net.terminals) {
+				diag[net_blocks[i]] += weight;
+				rhs[net_blocks[i]][0] += weight * (pin->bb.ll.x + pin->bb.w / 2.0);
+				rhs[net_blocks[i]][1] += weight * (pin->bb.ll.y + pin->bb.h / 2.0);
+			}
+		}
+	}
+
+	// solve system, separately for x- and y-coordinates; start from die center
+	coords.assign(blocks.size(), {{outline.x / 2.0, outline.y / 2.0}});
+
+	for (unsigned c = 0; c < 2; c++) {
+		std::vector<double> r(blocks.size()), z(blocks.size()), p(blocks.size()), Ap(blocks.size());
+		double rz, rz_prev, alpha, r_norm, rhs_norm;
+
+		// residual r = rhs - A x, preconditioned residual z
+		rz = r_norm = rhs_norm = 0.0;
+		for (b = 0; b < blocks.size(); b++) {
+
+			r[b] = rhs[b][c] - diag[b] * coords[b][c];
+			for (auto const& w : weights[b]) {
+				r[b] += w.second * coords[w.first][c];
+			}
+
+			z[b] = r[b] / diag[b];
+			p[b] = z[b];
+			rz += r[b] * z[b];
+			r_norm += r[b] * r[b];
+			rhs_norm += rhs[b][c] * rhs[b][c];
+		}
+
+		for (int it = 0; it < CorblivarCore::PLACEMENT_CG_ITERATIONS; it++) {
+
+			if (r_norm <= std::pow(CorblivarCore::PLACEMENT_CG_TOLERANCE, 2) * rhs_norm) {
+				break;
+			}
+
+			// Ap = A p, alpha = rz / (p A p)
+			alpha = 0.0;
+			for (b = 0; b < blocks.size(); b++) {
+
+				Ap[b] = diag[b] * p[b];
+				for (auto const& w : weights[b]) {
+					Ap[b] -= w.second * p[w.first];
+				}
+
+				alpha += p[b] * Ap[b];
+			}
+			alpha = rz / alpha;
+
+			r_norm = 0.0;
+			for (b = 0; b < blocks.size(); b++) {
+				coords[b][c] += alpha * p[b];
+				r[b] -= alpha * Ap[b];
+				r_norm += r[b] * r[b];
+			}
+
+			rz_prev = rz;
+			rz = 0.0;
+			for (b = 0; b < blocks.size(); b++) {
+				z[b] = r[b] / diag[b];
+				rz += r[b] * z[b];
+			}
+
+			for (b = 0; b < blocks.size(); b++) {
+				p[b] = z[b] + (rz / rz_prev) * p[b];
+			}
+		}
+	}
+
+	// convert into CBLs, separately for each die
+	for (CorblivarDie& die : this->dies) {
+
+		tuples_die.clear();
+
+		for (Block const* cur_block : die.CBL.S) {
+
+			b = cur_block - blocks.data();
+
+			CornerBlockList::Tuple cur_tuple;
+			cur_tuple.S = cur_block;
+			if (coords[b][0] / outline.x > coords[b][1] / outline.y) {
+				cur_tuple.L = Direction::HORIZONTAL;
+			}
+			else {
+				cur_tuple.L = Direction::VERTICAL;
+			}
+			cur_tuple.T = 0;
+
+			tuples_die.push_back(std::move(cur_tuple));
+		}
+
+		std::sort(tuples_die.begin(), tuples_die.end(),
+			[&](CornerBlockList::Tuple const& t1, CornerBlockList::Tuple const& t2) {
+				unsigned const b1 = t1.S - blocks.data();
+				unsigned const b2 = t2.S - blocks.data();
+
+				return (b1 != b2) && (coords[b1][0] / outline.x + coords[b1][1] / outline.y < coords[b2][0] / outline.x + coords[b2][1] / outline.y);
+			}
+		);
+
+		die.CBL.clear();
+		for (CornerBlockList::Tuple& cur_tuple : tuples_die) {
+			die.CBL.insert(std::move(cur_tuple));
+		}
+	}
+
+	if (CorblivarCore::DBG) {
+		for (CorblivarDie const& die : this->dies) {
+			std::cout << "DBG_CORE> ";
+			std::cout << "CBL tuples for die " << die.id + 1 << " after analytical placement; " << die.CBL.size() << " tuples:" << std::endl;
+			std::cout << die.CBL.CBLString() << std::endl;
+		}
+	}
+
+	if (log) {
+		std::cout << "Corblivar> ";
+		std::cout << "Done" << std::endl << std::endl;
+	}
+}
+
+void CorblivarCore::partitionBlocks(std::vector<unsigned> const& part, int const& die, int const& dies_count,
+		std::vector<Block> const& blocks, std::vector< std::vector<unsigned> > const& nets_blocks,
+		std::vector< std::vector<unsigned> > const& blocks_nets, bool const& power_aware_assignment,
+		std::vector<int>& blocks_dies) {
+	std::vector<unsigned> part_0, part_1;
+	int dies_count_0;
+
+	if (dies_count == 1) {
+
+		for (unsigned const& b : part) {
+			blocks_dies[b] = die;
+		}
+
+		return;
+	}
+
+	// the blocks area is balanced w.r.t. the dies count of both parts
+	dies_count_0 = dies_count / 2;
+
+	// for power-aware assignment, the lower dies, i.e., part_0, receive the blocks w/
+	// lower power densities
+	CorblivarCore::bisectBlocks(part, static_cast<double>(dies_count_0) / dies_count, blocks, nets_blocks, blocks_nets, power_aware_assignment, part_0, part_1);
+
+	CorblivarCore::partitionBlocks(part_0, die, dies_count_0, blocks, nets_blocks, blocks_nets, power_aware_assignment, blocks_dies);
+	CorblivarCore::partitionBlocks(part_1, die + dies_count_0, dies_count - dies_count_0, blocks, nets_blocks, blocks_nets, power_aware_assignment, blocks_dies);
+}
+
+/// min-cut bisection, Fiduccia-Mattheyses heuristic; for each of several random
+/// starts, passes of tentative moves are performed as long as the cut improves; each
+/// pass moves every block at most once, always the movable block of highest gain, and
+/// rolls back to the best cut encountered during the pass; moves are only allowed
+/// w/in the tolerance for the blocks-area balance
+///
+/// for power-aware assignment, the blocks are ordered by their power densities, as
+/// for initCorblivarRandomly, and the threshold density is determined where the blocks
+/// area is balanced; blocks below/above the threshold are fixed to part_0/part_1 and
+/// only the blocks of the threshold density are subject to the min-cut bisection; this
+/// way, the power-aware constraint of LayoutOperations::performOpMoveOrSwapBlocks holds
+/// for all pairs of blocks
+unsigned CorblivarCore::bisectBlocks(std::vector<unsigned> const& part, double const& area_ratio,
+		std::vector<Block> const& blocks, std::vector< std::vector<unsigned> > const& nets_blocks,
+		std::vector< std::vector<unsigned> > const& blocks_nets, bool const& power_aware_assignment,
+		std::vector<unsigned>& part_0, std::vector<unsigned>& part_1) {
+	std::vector<int> side, best_side, fixed_side;
+	std::vector<std::array<unsigned, 2>> nets_count;
+	std::vector<bool> locked;
+	std::vector<int> gains;
+	std::vector<unsigned> order, moves;
+	double area, area_0, area_tolerance, threshold_density;
+	unsigned cut, best_cut, pass_cut, run_best_cut;
+	unsigned moves_best;
+	int best_gain;
+	int best;
+	bool improved;
+
+	// blocks of this part are marked by their side, others by -1
+	side.assign(blocks.size(), -1);
+	nets_count.resize(nets_blocks.size());
+	locked.assign(blocks.size(), false);
+	gains.assign(blocks.size(), 0);
+	// blocks fixed to one side, others marked by -1
+	fixed_side.assign(blocks.size(), -1);
+
+	area = area_tolerance = 0.0;
+	for (unsigned const& b : part) {
+		area += blocks[b].bb.area;
+		area_tolerance = std::max(area_tolerance, blocks[b].bb.area);
+	}
+	// at least the largest block has to be movable
+	area_tolerance = std::max(area_tolerance, CorblivarCore::PARTITIONING_AREA_TOLERANCE * area);
+
+	// for power-aware assignment, determine threshold density and fix all other
+	// blocks accordingly
+	if (power_aware_assignment) {
+
+		order = part;
+		std::stable_sort(order.begin(), order.end(),
+			[&](unsigned const& b1, unsigned const& b2) {
+				return blocks[b1].power_density() < blocks[b2].power_density();
+			}
+		);
+
+		area_0 = 0.0;
+		threshold_density = blocks[order.back()].power_density();
+		for (unsigned const& b : order) {
+
+			area_0 += blocks[b].bb.area;
+
+			if (area_0 >= area_ratio * area) {
+				threshold_density = blocks[b].power_density();
+				break;
+			}
+		}
+
+		for (unsigned const& b : part) {
+
+			if (blocks[b].power_density() < threshold_density) {
+				fixed_side[b] = 0;
+			}
+			else if (blocks[b].power_density() > threshold_density) {
+				fixed_side[b] = 1;
+			}
+		}
+	}
+
+	// gain for moving a block to the other side, i.e., the change of cut nets
+	auto blockGain = [&](unsigned const& b) {
+		int g = 0;
+
+		for (unsigned const& n : blocks_nets[b]) {
+
+			// nets w/ only one block in this part are never cut
+			if (nets_count[n][0] + nets_count[n][1] < 2) {
+				continue;
+			}
+
+			if (nets_count[n][side[b]] == 1) {
+				g++;
+			}
+			if (nets_count[n][1 - side[b]] == 0) {
+				g--;
+			}
+		}
+
+		return g;
+	};
+
+	best_cut = std::numeric_limits<unsigned>::max();
+	order = part;
+
+	for (int run = 0; run < CorblivarCore::PARTITIONING_RUNS; run++) {
+
+		// random initial bisection, w/ balanced blocks area; fixed blocks are
+		// assigned first
+		std::shuffle(order.begin(), order.end(), Math::randEngine());
+
+		area_0 = 0.0;
+		for (unsigned const& b : order) {
+
+			side[b] = fixed_side[b];
+
+			if (side[b] == 0) {
+				area_0 += blocks[b].bb.area;
+			}
+		}
+		for (unsigned const& b : order) {
+
+			if (side[b] != -1) {
+				continue;
+			}
+
+			if (area_0 < area_ratio * area) {
+				side[b] = 0;
+				area_0 += blocks[b].bb.area;
+			}
+			else {
+				side[b] = 1;
+			}
+		}
+
+		// init nets' counts of blocks on both sides, and cut
+		cut = 0;
+		for (unsigned n = 0; n < nets_blocks.size(); n++) {
+
+			nets_count[n] = {{0, 0}};
+
+			for (unsigned const& b : nets_blocks[n]) {
+
+				if (side[b] != -1) {
+					nets_count[n][side[b]]++;
+				}
+			}
+
+			if (nets_count[n][0] > 0 && nets_count[n][1] > 0) {
+				cut++;
+			}
+		}
+
+		// FM passes
+		for (int pass = 0; pass < CorblivarCore::PARTITIONING_PASSES; pass++) {
+
+			pass_cut = run_best_cut = cut;
+			moves.clear();
+			moves_best = 0;
+
+			// fixed blocks are never moved
+			for (unsigned const& b : part) {
+				locked[b] = (fixed_side[b] != -1);
+				gains[b] = blockGain(b);
+			}
+
+			while (moves.size() < part.size()) {
+
+				// select movable block w/ highest gain
+				best = -1;
+				best_gain = 0;
+
+				for (unsigned const& b : part) {
+
+					if (locked[b]) {
+						continue;
+					}
+
+					// balance of blocks area
+					if (side[b] == 0) {
+						if (std::abs(area_0 - blocks[b].bb.area - area_ratio * area) > area_tolerance) {
+							continue;
+						}
+					}
+					else {
+						if (std::abs(area_0 + blocks[b].bb.area - area_ratio * area) > area_tolerance) {
+							continue;
+						}
+					}
+
+					if (best == -1 || gains[b] > best_gain) {
+						best = b;
+						best_gain = gains[b];
+					}
+				}
+
+				if (best == -1) {
+					break;
+				}
+
+				// tentative move
+				for (unsigned const& n : blocks_nets[best]) {
+					nets_count[n][side[best]]--;
+					nets_count[n][1 - side[best]]++;
+				}
+				if (side[best] == 0) {
+					area_0 -= blocks[best].bb.area;
+				}
+				else {
+					area_0 += blocks[best].bb.area;
+				}
+				side[best] = 1 - side[best];
+				locked[best] = true;
+				cut -= best_gain;
+				moves.push_back(best);
+
+				// update gains of connected blocks
+				for (unsigned const& n : blocks_nets[best]) {
+					for (unsigned const& b : nets_blocks[n]) {
+
+						if (side[b] != -1 && !locked[b]) {
+							gains[b] = blockGain(b);
+						}
+					}
+				}
+
+				if (cut < run_best_cut) {
+					run_best_cut = cut;
+					moves_best = moves.size();
+				}
+			}
+
+			// roll back moves behind the best cut
+			while (moves.size() > moves_best) {
+
+				unsigned const b = moves.back();
+
+				for (unsigned const& n : blocks_nets[b]) {
+					nets_count[n][side[b]]--;
+					nets_count[n][1 - side[b]]++;
+				}
+				if (side[b] == 0) {
+					area_0 -= blocks[b].bb.area;
+				}
+				else {
+					area_0 += blocks[b].bb.area;
+				}
+				side[b] = 1 - side[b];
+
+				moves.pop_back();
+			}
+			cut = run_best_cut;
+
+			improved = (cut < pass_cut);
+			if (!improved) {
+				break;
+			}
+		}
+
+		// memorize best bisection over all runs
+		if (cut < best_cut) {
+			best_cut = cut;
+			best_side = side;
+		}
+	}
+
+	part_0.clear();
+	part_1.clear();
+
+	for (unsigned const& b : part) {
+
+		if (best_side[b] == 0) {
+			part_0.push_back(b);
+		}
+		else {
+			part_1.push_back(b);
+		}
+	}
+
+	if (CorblivarCore::DBG) {
+		std::cout << "DBG_CORE> Bisection of " << part.size() << " blocks into " << part_0.size() << " and " << part_1.size() << " blocks; cut nets: " << best_cut << std::endl;
+	}
+
+	return best_cut;
+}
+
 bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	Block const* cur_block;
 	Block const* other_block;
@@ -31,6 +31,7 @@
 #include "CorblivarAlignmentReq.hpp"
 // forward declarations, if any
 class Block;
+class Net;
 
 /// Corblivar core (data structures, layout operations)
 class CorblivarCore {
@@ -88,6 +89,39 @@ class CorblivarCore {
 		/// handler for block alignment
 		std::vector<CorblivarAlignmentReq const*> findAlignmentReqs(Block const* b) const;
 
+		/// partitioning-based initialization; random starts for each bisection
+		static constexpr int PARTITIONING_RUNS = 4;
+		/// partitioning-based initialization; max passes of FM refinement for
+		/// each bisection
+		static constexpr int PARTITIONING_PASSES = 10;
+		/// partitioning-based initialization; tolerance for the blocks-area
+		/// balance of bisections, relative to the blocks area
+		static constexpr double PARTITIONING_AREA_TOLERANCE = 0.05;
+		/// placement-based initialization; weight of the anchor of blocks to
+		/// the die center, relative to the weight of two-pin nets
+		static constexpr double PLACEMENT_ANCHOR_WEIGHT = 0.01;
+		/// placement-based initialization; nets w/ more blocks are ignored
+		static constexpr unsigned PLACEMENT_NET_DEGREE_MAX = 16;
+		/// placement-based initialization; max iterations of conjugate gradients
+		static constexpr int PLACEMENT_CG_ITERATIONS = 200;
+		/// placement-based initialization; tolerance for conjugate gradients,
+		/// relative to the norm of the right-hand side
+		static constexpr double PLACEMENT_CG_TOLERANCE = 1.0e-6;
+
+		/// partitioning-based initialization; recursive bisection of blocks into
+		/// given dies
+		static void partitionBlocks(std::vector<unsigned> const& part, int const& die, int const& dies_count,
+				std::vector<Block> const& blocks, std::vector< std::vector<unsigned> > const& nets_blocks,
+				std::vector< std::vector<unsigned> > const& blocks_nets, bool const& power_aware_assignment,
+				std::vector<int>& blocks_dies);
+		/// partitioning-based initialization; min-cut bisection of blocks,
+		/// returns the cut-nets count; for power-aware assignment, no block in
+		/// part_0 has a higher power density than any block in part_1
+		static unsigned bisectBlocks(std::vector<unsigned> const& part, double const& area_ratio,
+				std::vector<Block> const& blocks, std::vector< std::vector<unsigned> > const& nets_blocks,
+				std::vector< std::vector<unsigned> > const& blocks_nets, bool const& power_aware_assignment,
+				std::vector<unsigned>& part_0, std::vector<unsigned>& part_1);
+
 	// constructors, destructors, if any non-implicit
 	public:
 		/// default constructor
@@ -111,6 +145,13 @@ class CorblivarCore {
 
 		/// general operations; randomly setup data structure from input
 		void initCorblivarRandomly(bool const& log, int const& layers, std::vector<Block> const& blocks, bool const& power_aware_assignment);
+		/// general operations; setup data structure from input, w/ blocks
+		/// assigned to dies by min-cut partitioning of the nets
+		void initCorblivarPartitioned(bool const& log, int const& layers, std::vector<Block> const& blocks, std::vector<Net> const& nets,
+				bool const& power_aware_assignment);
+		/// general operations; order CBLs and set insertion directions by
+		/// analytical placement, maintaining the die assignment
+		void orderCBLsByPlacement(bool const& log, std::vector<Block> const& blocks, std::vector<Net> const& nets, Point const& outline);
 		/// general operations; generate layout from data structure
 		bool generateLayout(bool const& perform_alignment);
 
@@ -117,6 +117,8 @@ class CorblivarDie {
 	// public data, functions
 	public:
 		friend class CorblivarCore;
+		/// access to best-solution CBL, required for SA checkpoints
+		friend class IO;
 
 		/// setter
 		inline CornerBlockList& editCBL() {
@@ -144,6 +146,10 @@ class CorblivarDie {
 			return this->CBL.L[this->pi];
 		};
 		/// getter
+		inline Direction const& getDirection(unsigned const& tuple) const {
+			return this->CBL.L[tuple];
+		};
+		/// getter
 		inline unsigned const& getJunctions(unsigned const& tuple) const {
 			return this->CBL.T[tuple];
 		};
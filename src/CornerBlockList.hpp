@@ -52,6 +52,8 @@ class CornerBlockList {
 	public:
 		friend class CorblivarCore;
 		friend class CorblivarDie;
+		/// direct access to sequences, required for SA checkpoints
+		friend class IO;
 
 		/// POD; wrapper for tuples of separate sequences
 		struct Tuple {
@@ -116,6 +118,18 @@ class CornerBlockList {
 			this->T.push_back(tuple.T);
 		};
 
+		/// copy CBL of another instance, i.e., of another set of blocks; the
+		/// blocks are mapped via their index in the related vectors
+		inline void assign(CornerBlockList const& CBL, std::vector<Block> const& CBL_blocks, std::vector<Block> const& blocks) {
+
+			this->S.clear();
+			for (Block const* b : CBL.S) {
+				this->S.push_back(&blocks[b - CBL_blocks.data()]);
+			}
+			this->L = CBL.L;
+			this->T = CBL.T;
+		};
+
 		/// tuple string
 		inline std::string tupleString(unsigned const& tuple) const {
 			std::stringstream ret;
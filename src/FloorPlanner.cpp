@@ -65,44 +65,125 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	bool SA_phase_two, SA_phase_two_init;
 	bool valid_layout;
 	TempPhase cooling_phase;
+	std::chrono::steady_clock::time_point SA_start;
+	bool time_budget_reached;
+	int loop_limit, innerLoopMax_regular, innerLoopCur;
+	std::chrono::steady_clock::time_point step_start;
+	unsigned long step_moves;
+	double moves_per_s;
+	std::chrono::steady_clock::time_point telemetry_last;
+	double telemetry_elapsed;
+	unsigned long telemetry_moves;
+	Cost best_cost_terms;
+	std::chrono::steady_clock::time_point checkpoint_last;
+	std::chrono::steady_clock::time_point op_start;
+	bool speculative_commit;
+	unsigned speculative_commit_candidate, speculative_rejected_bound;
+	std::mt19937 rand_engine_backup;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::performSA(" << &corb << ")" << std::endl;
 	}
 
-	// for handling floorplacement benchmarks, i.e., floorplanning w/ very large
-	// blocks, we handle this naively by preferring these large blocks in the lower
-	// left corner, i.e., perform a sorting of the sequences by block size
-	//
-	// also, for random layout operations in SA phase one, these blocks are not
-	// allowed to be swapped or moved, see performOpMoveOrSwapBlocks
-	if (this->layoutOp.parameters.floorplacement) {
-		corb.sortCBLs(this->logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
+	// memorize start time of SA, required for time budget and statistics
+	SA_start = telemetry_last = checkpoint_last = std::chrono::steady_clock::now();
+	this->SA_stats.moves = telemetry_moves = 0;
+	this->SA_stats.converged = false;
+	time_budget_reached = false;
+
+	// init replicas and worker threads for speculative moves and parallel sampling,
+	// if configured for
+	if (std::max(this->schedule.speculative_moves, this->schedule.sampling_walks) > 0) {
+		this->initWorkers(corb, std::max(this->schedule.speculative_moves, this->schedule.sampling_walks));
 	}
 
-	// init SA: initial sampling; setup parameters, setup temperature schedule
-	this->initSA(corb, cost_samples, innerLoopMax, init_temp);
+	// resume SA from checkpoint; restore loop state, the remaining data is restored
+	// directly into this instance and into the Corblivar core
+	if (this->IO_conf.checkpoint_in.is_open()) {
+
+		IO::parseCheckpoint(*this, corb);
+
+		i = this->SA_checkpoint.step;
+		loop_limit = this->SA_checkpoint.loop_limit;
+		innerLoopMax = this->SA_checkpoint.innerLoopMax;
+		innerLoopMax_regular = this->SA_checkpoint.innerLoopMax_regular;
+		cur_temp = this->SA_checkpoint.temp;
+		cooling_phase = this->SA_checkpoint.cooling_phase;
+		SA_phase_two = this->SA_checkpoint.SA_phase_two;
+		SA_phase_two_init = false;
+		fitting_layouts_ratio = this->SA_checkpoint.fitting_layouts_ratio;
+		valid_layout_found = this->SA_checkpoint.valid_layout_found;
+		i_valid_layout_found = this->SA_checkpoint.step_valid_layout_found;
+		best_cost = this->SA_checkpoint.best_cost;
+		best_cost_terms = this->SA_checkpoint.best_cost_terms;
+		moves_per_s = this->SA_checkpoint.moves_per_s;
+		telemetry_moves = this->SA_stats.moves;
+
+		// continue timing where the checkpointed run stopped
+		SA_start -= std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(this->SA_checkpoint.elapsed));
+
+		if (this->logMed()) {
+			std::cout << "SA> Resume simulated annealing process in step " << i << "..." << std::endl;
+			std::cout << "SA> " << std::endl;
+		}
+	}
+	else {
+		// for handling floorplacement benchmarks, i.e., floorplanning w/ very large
+		// blocks, we handle this naively by preferring these large blocks in the lower
+		// left corner, i.e., perform a sorting of the sequences by block size
+		//
+		// also, for random layout operations in SA phase one, these blocks are not
+		// allowed to be swapped or moved, see performOpMoveOrSwapBlocks
+		if (this->layoutOp.parameters.floorplacement) {
+			corb.sortCBLs(this->logMed(), CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
+		}
+
+		// init SA: initial sampling; setup parameters, setup temperature schedule
+		this->initSA(corb, cost_samples, innerLoopMax, init_temp);
+
+		// init loop control; for a time budget, the inner-loop length and the outer-loop
+		// limit are adapted online, initially based on the throughput during sampling
+		innerLoopMax_regular = innerLoopMax;
+		loop_limit = this->schedule.loop_limit;
+		moves_per_s = cost_samples.size() / std::chrono::duration<double>(std::chrono::steady_clock::now() - SA_start).count();
+
+		/// main SA loop
+		//
+		// init loop parameters
+		i = 1;
+		cur_temp = init_temp;
+		cooling_phase = TempPhase::PHASE_1;
+		SA_phase_two = SA_phase_two_init = false;
+		valid_layout_found = false;
+		i_valid_layout_found = Point::UNDEF;
+		fitting_layouts_ratio = 0.0;
+		// dummy large value to accept first fitting solution
+		best_cost = 10e6 * Math::stdDev(cost_samples);
+	}
 
-	/// main SA loop
-	//
-	// init loop parameters
-	i = 1;
-	cur_temp = init_temp;
-	cooling_phase = TempPhase::PHASE_1;
-	SA_phase_two = SA_phase_two_init = false;
-	valid_layout_found = false;
-	i_valid_layout_found = Point::UNDEF;
-	fitting_layouts_ratio = 0.0;
-	// dummy large value to accept first fitting solution
-	best_cost = 10e6 * Math::stdDev(cost_samples);
 
 	/// outer loop: annealing -- temperature steps
-	while (i <= this->schedule.loop_limit) {
+	while (i <= loop_limit && !time_budget_reached) {
+
+		if (this->schedule.time_budget > 0.0) {
+			this->adaptScheduleTimeBudget(std::chrono::duration<double>(std::chrono::steady_clock::now() - SA_start).count(),
+					moves_per_s, i, innerLoopMax_regular, innerLoopMax, loop_limit);
+		}
+
+		// adapt inner-loop length to acceptance ratio of previous step, if
+		// configured for
+		innerLoopCur = innerLoopMax;
+		if (this->schedule.adaptive_inner_loop && !this->tempSchedule.empty()) {
+			innerLoopCur = this->adaptInnerLoop(innerLoopMax, this->tempSchedule.back().accepted_ops_ratio);
+		}
 
 		if (this->logMax()) {
-			std::cout << "SA> Optimization step: " << i << "/" << this->schedule.loop_limit << std::endl;
+			std::cout << "SA> Optimization step: " << i << "/" << loop_limit << std::endl;
 		}
 
+		step_start = std::chrono::steady_clock::now();
+		step_moves = this->SA_stats.moves;
+
 		// init loop parameters
 		ii = 1;
 		avg_cost = 0.0;
@@ -116,11 +197,87 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 		cur_cost = this->evaluateLayout(corb.getAlignments(), fitting_layouts_ratio, SA_phase_two).total_cost;
 
 		// inner loop: layout operations
-		while (ii <= innerLoopMax) {
+		while (ii <= innerLoopCur && !time_budget_reached) {
+
+			// speculative moves, if configured for; only in SA phase two where
+			// most moves are rejected: a batch of candidate moves, all derived
+			// from the current layout, is evaluated in parallel and the first
+			// accepted candidate is committed
+			speculative_commit = false;
+			if (SA_phase_two && this->schedule.speculative_moves > 0) {
+
+				speculative_rejected_bound = 0;
+
+				this->evaluateCandidateMoves(corb, cur_cost, cur_temp, fitting_layouts_ratio, layout_fit_counter, (cooling_phase == TempPhase::PHASE_3));
+
+				for (unsigned k = 0; k < this->schedule.speculative_moves; k++) {
+
+					SpeculativeCandidate const& candidate = this->speculation.candidates[k];
+
+					if (!candidate.op_success) {
+						continue;
+					}
+
+					// candidates behind the committed one, or beyond the
+					// inner loop, are discarded
+					if (speculative_commit || ii > innerLoopCur) {
+						this->speculation.discarded++;
+					}
+					// first accepted candidate; to be committed by
+					// reproducing the move below, i.e., w/ the same seed
+					else if (candidate.accept) {
+						speculative_commit = true;
+						speculative_commit_candidate = k;
+
+						rand_engine_backup = Math::randEngine();
+						Math::seed(candidate.seed);
+					}
+					// rejected candidates are handled like regular
+					// rejected ops; their statistics of layout operations
+					// are updated only after reproducing the committed
+					// candidate, see below
+					else {
+						speculative_rejected_bound = k + 1;
+
+						this->SA_stats.moves++;
+						ii++;
+					}
+				}
+
+				if (!speculative_commit) {
+
+					this->updateSpeculativeOpStats(SA_phase_two, cur_cost, speculative_rejected_bound);
+
+					// check time budget, if any
+					time_budget_reached = this->checkTimeBudget(SA_start);
+
+					continue;
+				}
+			}
 
-			// perform layout op
+			// perform layout op; also track runtime of op, layout generation, and
+			// evaluation for statistics of layout operations
+			op_start = std::chrono::steady_clock::now();
 			op_success = layoutOp.performLayoutOp(corb, layout_fit_counter, SA_phase_two, false, (cooling_phase == TempPhase::PHASE_3));
 
+			// the committed candidate is reproduced by the op above; restore the
+			// random-number generator of the main thread afterwards; the op
+			// selection of the replica considered the statistics of layout
+			// operations as of the start of the batch, thus the statistics for
+			// the rejected candidates ahead are updated only now
+			if (speculative_commit) {
+				Math::randEngine() = rand_engine_backup;
+
+				this->updateSpeculativeOpStats(SA_phase_two, cur_cost, speculative_rejected_bound);
+
+				// the op is not reproduced as evaluated by the replica; handle
+				// it as regular op, i.e., w/ the regular acceptance test
+				if (!op_success || this->layoutOp.lastOp() != this->speculation.candidates[speculative_commit_candidate].op) {
+					speculative_commit = false;
+					this->speculation.mismatched++;
+				}
+			}
+
 			if (op_success) {
 
 				prev_cost = cur_cost;
@@ -150,14 +307,30 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 				// cost difference
 				cost_diff = cur_cost - prev_cost;
 
+				// the committed candidate must result in the same cost as
+				// evaluated by the replica; otherwise, handle it as regular
+				// op, see above
+				if (speculative_commit && std::abs(cost_diff - this->speculation.candidates[speculative_commit_candidate].cost_diff) > Math::epsilon) {
+					speculative_commit = false;
+					this->speculation.mismatched++;
+				}
+
+				// statistics
+				this->SA_stats.moves++;
+
+				// check time budget, if any; the current op is still
+				// handled regularly, then both loops are left
+				time_budget_reached = this->checkTimeBudget(SA_start);
+
 				if (FloorPlanner::DBG_SA) {
-					std::cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopMax << std::endl;
+					std::cout << "DBG_SA> Inner step: " << ii << "/" << innerLoopCur << std::endl;
 					std::cout << "DBG_SA> Cost diff: " << cost_diff << std::endl;
 				}
 
-				// revert solution w/ worse or same cost, depending on temperature
+				// revert solution w/ worse or same cost, depending on temperature;
+				// a committed candidate of speculative moves is accepted already
 				accept = true;
-				if (cost_diff >= 0.0) {
+				if (cost_diff >= 0.0 && !speculative_commit) {
 					r = Math::randF(0, 1);
 					if (r > exp(- cost_diff / cur_temp)) {
 
@@ -173,6 +346,11 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 					}
 				}
 
+				// statistics of layout operations; required for adaptive
+				// selection of operations
+				this->layoutOp.updateOpStats(SA_phase_two, prev_cost, cost_diff, accept,
+						std::chrono::duration<double>(std::chrono::steady_clock::now() - op_start).count());
+
 				// solution to be accepted, i.e., previously not reverted
 				if (accept) {
 					// update ops count
@@ -255,6 +433,12 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 							// update count of solutions
 							// fitting into outline
 							layout_fit_counter++;
+
+							// consider solution for Pareto
+							// archive, if configured for
+							if (this->schedule.pareto_archive > 0) {
+								this->updateParetoArchive(corb, cost, i);
+							}
 						}
 
 						// memorize best solution which fits into outline
@@ -293,245 +477,1609 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 							// estimates for global I/O nets
 							// connecting to those pins
 							else {
-								Point outline;
-
-								for (Block const& b : this->blocks) {
-									outline.x = std::max(outline.x, b.bb.ur.x);
-									outline.y = std::max(outline.y, b.bb.ur.y);
-								}
-
-								this->scaleTerminalPins(outline);
+								this->scaleTerminalPins(this->determBlocksOutline());
 							}
 
 							// re-evaluate cost after
 							// shrinking die outline and/or
-							// scaling terminal pins
-							fitting_cost =
-								this->evaluateLayout(corb.getAlignments(), 1.0, SA_phase_two).total_cost;
+							// scaling terminal pins; also
+							// memorize all cost terms
+							best_cost_terms = this->evaluateLayout(corb.getAlignments(), 1.0, SA_phase_two);
+							fitting_cost = best_cost_terms.total_cost;
 
 							best_cost = fitting_cost;
 							corb.storeBestCBLs();
 
-							valid_layout_found = best_sol_found = true;
-						}
-					}
-				}
+							valid_layout_found = best_sol_found = true;
+						}
+					}
+				}
+
+				// SA telemetry, if activated; write progress record
+				// periodically; ignore the op triggering the phase
+				// transition since its cost terms are not complete
+				if (this->IO_conf.telemetry.is_open() && !SA_phase_two_init) {
+
+					telemetry_elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - telemetry_last).count();
+
+					if (telemetry_elapsed >= this->IO_conf.telemetry_interval) {
+
+						this->writeTelemetry(
+								std::chrono::duration<double>(std::chrono::steady_clock::now() - SA_start).count(),
+								i, cur_temp, cooling_phase, SA_phase_two,
+								(this->SA_stats.moves - telemetry_moves) / telemetry_elapsed,
+								static_cast<double>(accepted_ops) / ii,
+								fitting_layouts_ratio,
+								cost,
+								valid_layout_found ? &best_cost_terms : nullptr
+							);
+
+						telemetry_last = std::chrono::steady_clock::now();
+						telemetry_moves = this->SA_stats.moves;
+					}
+				}
+
+				// after phase transition, skip current global iteration
+				// in order to consider updated cost function
+				if (SA_phase_two_init) {
+					break;
+				}
+				// consider next loop iteration
+				else {
+					ii++;
+				}
+			}
+		}
+
+		// determine ratio of solutions fitting into outline in current temp step;
+		// note that during the next temp step this ratio is fixed in order to
+		// avoid sudden changes of related cost terms during few iterations
+		if (accepted_ops > 0) {
+			fitting_layouts_ratio = static_cast<double>(layout_fit_counter) / accepted_ops;
+		}
+		else {
+			fitting_layouts_ratio = 0.0;
+		}
+
+		// determine avg cost for temp step
+		if (accepted_ops > 0) {
+			avg_cost /= accepted_ops;
+		}
+
+		// determine accepted-ops ratio
+		accepted_ops_ratio = static_cast<double>(accepted_ops) / ii;
+
+		// determine throughput of temp step
+		if (this->SA_stats.moves > step_moves) {
+			moves_per_s = (this->SA_stats.moves - step_moves) / std::chrono::duration<double>(std::chrono::steady_clock::now() - step_start).count();
+		}
+
+		if (this->logMax()) {
+			std::cout << "SA> Step done:" << std::endl;
+			std::cout << "SA>  New best solution found: " << best_sol_found << std::endl;
+
+			// log details for current best solution; first, backup current
+			// (most likely not that particular best new solution)
+			corb.backupCBLs();
+
+			// apply best new solution, no logging in case no best solution is
+			// found yet
+			corb.applyBestCBLs(false);
+			this->generateLayout(corb, this->opt_flags.alignment);
+
+			// enable voltage assignment based on initial threshold value, but also backup current threshold
+			double cur_threshold = this->IC.delay_threshold;
+			this->IC.delay_threshold = this->IC.delay_threshold_initial;
+
+			// determine cost terms and overall cost for new best solution;
+			// assume fitting ratio of 1.0 for better comparability of
+			// different solutions and their cost
+			cost = this->evaluateLayout(corb.getAlignments(), 1.0, SA_phase_two);
+
+			// restore current threshold
+			this->IC.delay_threshold = cur_threshold;
+
+			if (SA_phase_two) {
+				std::cout << "SA>   Current best solution; overall cost: " << cost.total_cost << std::endl;
+			}
+			else {
+				std::cout << "SA>   Current solution, not fitting yet into the outline; overall cost: " << cost.total_cost << std::endl;
+			}
+			// always log the current state for fitting the blocks into the
+			// fixed outline
+			std::cout << "SA>    Current max AR mismatch (ideal value is 0.0): " << cost.outline_actual_value << std::endl;
+			std::cout << "SA>    Current max packing overhead (ideal value is 0.0): " << cost.area_actual_value << std::endl;
+
+			// log other more detailed cost term only for phase two
+			if (SA_phase_two) {
+
+				if (this->opt_flags.alignment) {
+					std::cout << "SA>    Alignment mismatches [um]: " << cost.alignments_actual_value << std::endl;
+				}
+
+				std::cout << "SA>    Total power for blocks, wires and TSVs [W]: " << cost.power_blocks + cost.power_wires + cost.power_TSVs << std::endl;
+				std::cout << "SA>    HPWL: " << cost.HPWL_actual_value << std::endl;
+
+				if (this->opt_flags.routing_util) {
+					std::cout << "SA>    Max routing utilization: " << cost.routing_util_actual_value << std::endl;
+				}
+
+				if (this->opt_flags.thermal) {
+					std::cout << "SA>    Temp (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
+				}
+
+				if (this->opt_flags.timing || this->opt_flags.voltage_assignment) {
+
+					std::cout << "SA>    Timing (max delay [ns]): " << cost.timing_actual_value << std::endl;
+					// always display violation, also when it's negative
+					// (i.e., timing better than constraint)
+					std::cout << "SA>     Timing violation ([ns] / [%]): ";
+					std::cout << cost.timing_actual_value - this->IC.delay_threshold;
+					std::cout << " / ";
+					std::cout << cost.timing_actual_value * (100.0 / this->IC.delay_threshold) - 100.0;
+					std::cout << std::endl;
+					// is adapted dynamically for voltage assignment
+					std::cout << "SA>      Current timing threshold: " << this->IC.delay_threshold << std::endl;
+				}
+
+				// TODO add level shifter, avg corners; plot all only when according weight is defined
+				if (this->opt_flags.voltage_assignment) {
+
+					std::cout << "SA>    Voltage assignment; power reduction for blocks [W]: " << cost.voltage_assignment_power_saving << std::endl;
+					std::cout << "SA>    Voltage assignment; volume count: " << cost.voltage_assignment_modules_count << std::endl;
+					std::cout << "SA>    Voltage assignment; max std dev of power densities: " << cost.voltage_assignment_power_variation_max << std::endl;
+				}
+
+				if (this->opt_flags.thermal_leakage) {
+
+					std::cout << "SA>    Thermal leakage; avg spatial entropy of power maps: " << cost.thermal_leakage_entropy_actual_value << std::endl;
+					std::cout << "SA>    Thermal leakage; Pearson correlation of power and thermal map for lowest layer: " << cost.thermal_leakage_correlation_actual_value << std::endl;
+				}
+			}
+
+			std::cout << "SA>  Accept-ops ratio: " << accepted_ops_ratio << std::endl;
+			std::cout << "SA>  Inner-loop length: " << innerLoopCur << std::endl;
+			std::cout << "SA>  Valid-layouts ratio: " << fitting_layouts_ratio << std::endl;
+			std::cout << "SA>  Avg cost: " << avg_cost << std::endl;
+			std::cout << "SA>  SA temp: " << cur_temp << std::endl;
+
+			// finally, restore previous layout
+			corb.restoreCBLs();
+		}
+
+		// log temperature step
+		TempStep cur_step;
+		cur_step.step = i;
+		cur_step.temp = cur_temp;
+		cur_step.avg_cost = avg_cost;
+		cur_step.new_best_sol_found = best_sol_found;
+		cur_step.cost_best_sol = best_cost;
+		cur_step.inner_loop_max = innerLoopCur;
+		cur_step.accepted_ops_ratio = accepted_ops_ratio;
+		this->tempSchedule.push_back(std::move(cur_step));
+
+		// convergence-based termination, if configured for
+		if (this->schedule.stop_steps > 0 && valid_layout_found && this->checkConvergence(i, i_valid_layout_found)) {
+
+			this->SA_stats.converged = true;
+
+			if (this->logMed()) {
+				std::cout << "SA> Converged in step " << i << "; stop annealing" << std::endl;
+			}
+
+			break;
+		}
+
+		// update SA temperature
+		cooling_phase = this->updateTemp(cur_temp, i, i_valid_layout_found, loop_limit);
+
+		// consider next outer step
+		i++;
+
+		// SA checkpoint, if activated; write checkpoint periodically, covering the
+		// state at the beginning of the next temperature step
+		if (!this->IO_conf.checkpoint_file.empty() &&
+				std::chrono::duration<double>(std::chrono::steady_clock::now() - checkpoint_last).count() >= this->IO_conf.checkpoint_interval) {
+
+			this->SA_checkpoint.step = i;
+			this->SA_checkpoint.loop_limit = loop_limit;
+			this->SA_checkpoint.innerLoopMax = innerLoopMax;
+			this->SA_checkpoint.innerLoopMax_regular = innerLoopMax_regular;
+			this->SA_checkpoint.temp = cur_temp;
+			this->SA_checkpoint.cooling_phase = cooling_phase;
+			this->SA_checkpoint.SA_phase_two = SA_phase_two;
+			this->SA_checkpoint.fitting_layouts_ratio = fitting_layouts_ratio;
+			this->SA_checkpoint.valid_layout_found = valid_layout_found;
+			this->SA_checkpoint.step_valid_layout_found = i_valid_layout_found;
+			this->SA_checkpoint.best_cost = best_cost;
+			this->SA_checkpoint.best_cost_terms = best_cost_terms;
+			this->SA_checkpoint.moves_per_s = moves_per_s;
+			this->SA_checkpoint.elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - SA_start).count();
+
+			IO::writeCheckpoint(*this, corb);
+
+			checkpoint_last = std::chrono::steady_clock::now();
+		}
+	}
+
+	// statistics
+	this->SA_stats.SA_runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - SA_start).count();
+
+	if (this->logMed()) {
+		std::cout << "SA> Done; evaluated layout operations: " << this->SA_stats.moves;
+		std::cout << ", per second: " << this->SA_stats.moves / this->SA_stats.SA_runtime << std::endl;
+		this->layoutOp.logOpStats();
+		if (this->schedule.speculative_moves > 0) {
+			std::cout << "SA> Speculative moves; discarded candidates: " << this->speculation.discarded;
+			std::cout << ", committed candidates not reproduced: " << this->speculation.mismatched << std::endl;
+		}
+		std::cout << std::endl;
+	}
+
+	// terminate worker threads, if any
+	this->stopWorkers();
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::performSA : " << valid_layout_found << std::endl;
+	}
+
+	return valid_layout_found;
+}
+
+void FloorPlanner::writeTelemetry(double const& time, int const& step, double const& temp, TempPhase const& cooling_phase, bool const& SA_phase_two,
+		double const& moves_per_s, double const& accepted_ops_ratio, double const& fitting_layouts_ratio,
+		Cost const& cost, Cost const* best_cost) {
+	std::ofstream& out = this->IO_conf.telemetry;
+
+	// helper to write cost terms; note that in SA phase one, only area and outline
+	// cost are determined
+	auto writeCost = [&](Cost const& c) {
+		out << "{\"total\": " << c.total_cost;
+		out << ", \"area_outline\": " << c.area_outline;
+
+		if (SA_phase_two) {
+			out << ", \"HPWL\": " << c.HPWL;
+			out << ", \"routing_util\": " << c.routing_util;
+			out << ", \"TSVs\": " << c.TSVs;
+			out << ", \"alignments\": " << c.alignments;
+			out << ", \"thermal\": " << c.thermal;
+			out << ", \"timing\": " << c.timing;
+			out << ", \"voltage_assignment\": " << c.voltage_assignment;
+			out << ", \"thermal_leakage\": " << c.thermal_leakage;
+		}
+
+		out << "}";
+	};
+
+	out << "{\"benchmark\": \"" << this->benchmark << "\"";
+	out << ", \"time\": " << time;
+	out << ", \"step\": " << step;
+	out << ", \"moves\": " << this->SA_stats.moves;
+	out << ", \"moves_per_s\": " << moves_per_s;
+	out << ", \"accept_ratio\": " << accepted_ops_ratio;
+	out << ", \"fitting_ratio\": " << fitting_layouts_ratio;
+	out << ", \"temp\": " << temp;
+	out << ", \"SA_phase\": " << (SA_phase_two ? 2 : 1);
+	out << ", \"cooling_phase\": " << cooling_phase;
+
+	out << ", \"cost\": ";
+	writeCost(cost);
+
+	out << ", \"best_cost\": ";
+	if (best_cost != nullptr) {
+		writeCost(*best_cost);
+	}
+	else {
+		out << "null";
+	}
+
+	out << "}" << std::endl;
+}
+
+FloorPlanner::TempPhase FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout, int const& loop_limit) const {
+	float loop_factor;
+	double prev_temp;
+	TempPhase phase;
+	std::vector<double> prev_avg_cost;
+	double std_dev_avg_cost;
+	unsigned i, temp_schedule_size;
+
+	prev_temp = cur_temp;
+
+	// consider reheating in case the SA search has converged in some (possibly local) minima
+	//
+	// determine std dev of avg cost if some previous temperature steps exist
+	temp_schedule_size = this->tempSchedule.size();
+	if (temp_schedule_size >= FloorPlanner::SA_REHEAT_COST_SAMPLES) {
+
+		for (i = 1; i <= FloorPlanner::SA_REHEAT_COST_SAMPLES; i++) {
+			prev_avg_cost.push_back(this->tempSchedule[temp_schedule_size - i].avg_cost);
+		}
+
+		std_dev_avg_cost = Math::stdDev(prev_avg_cost);
+	}
+	// else ignore std dev by setting it above limit
+	else {
+		std_dev_avg_cost = FloorPlanner::SA_REHEAT_STD_DEV_COST_LIMIT + 1;
+	}
+
+	// phase 3; brief reheating due to cost convergence
+	if (std_dev_avg_cost <= FloorPlanner::SA_REHEAT_STD_DEV_COST_LIMIT) {
+
+		cur_temp *= this->schedule.temp_factor_phase3;
+
+		phase = TempPhase::PHASE_3;
+	}
+	// phase 1; adaptive cooling (slows down from schedule.temp_factor_phase1 to
+	// schedule.temp_factor_phase1_limit)
+	else if (iteration_first_valid_layout == Point::UNDEF) {
+
+		// note that the loop limit may be adapted for time-budgeted runs; thus it's
+		// bounded here
+		loop_factor = (this->schedule.temp_factor_phase1_limit - this->schedule.temp_factor_phase1) *
+			std::min(1.0, static_cast<float>(iteration - 1) / std::max(1.0, loop_limit - 1.0));
+
+		// note that loop_factor is additive in this case; the cooling factor is
+		// increased w/ increasing iterations
+		cur_temp *= this->schedule.temp_factor_phase1 + loop_factor;
+
+		phase = TempPhase::PHASE_1;
+	}
+	// phase 2; reheating and converging (initially reheats and then increases cooling
+	// rate faster, i.e., heating factor is decreased w/ increasing iterations to
+	// enable convergence)
+	else {
+		// note that loop_factor must only consider the remaining iteration range
+		loop_factor = 1.0 - std::min(1.0f, static_cast<float>(iteration - iteration_first_valid_layout) /
+			static_cast<float>(std::max(1, loop_limit - iteration_first_valid_layout)));
+
+		cur_temp *= this->schedule.temp_factor_phase2 * loop_factor;
+
+		phase = TempPhase::PHASE_2;
+	}
+
+	if (this->logMax()) {
+		std::cout << "SA>  (new) temp-update factor: " << cur_temp / prev_temp << " (phase " << phase << ")" << std::endl;
+	}
+
+	return phase;
+}
+
+void FloorPlanner::adaptScheduleTimeBudget(double const& elapsed, double const& moves_per_s, int const& iteration, int const& innerLoopMax_regular,
+		int& innerLoopMax, int& loop_limit) const {
+	double remaining_time, remaining_moves;
+	int remaining_steps;
+	int inner_min, inner_max;
+
+	// remaining time w.r.t. the share of the budget which is planned for
+	remaining_time = std::max(0.0, FloorPlanner::SA_BUDGET_SHARE * this->schedule.time_budget - elapsed);
+	// moves which can be expected to be performed w/in this time
+	remaining_moves = remaining_time * moves_per_s;
+	// remaining steps, including the current one, of the regular schedule
+	remaining_steps = std::max(1, static_cast<int>(this->schedule.loop_limit) - iteration + 1);
+
+	inner_min = std::max(1, static_cast<int>(FloorPlanner::SA_BUDGET_INNER_LOOP_MIN * innerLoopMax_regular));
+	inner_max = std::max(1, static_cast<int>(FloorPlanner::SA_BUDGET_INNER_LOOP_MAX * innerLoopMax_regular));
+
+	// the regular number of steps can be performed; spread the moves evenly
+	if (remaining_moves / remaining_steps >= inner_min) {
+
+		innerLoopMax = std::min(inner_max, static_cast<int>(remaining_moves / remaining_steps));
+		loop_limit = this->schedule.loop_limit;
+	}
+	// too few moves remaining; reduce the number of steps such that the schedule
+	// converges earlier, i.e., the temperature-update factors in updateTemp are
+	// compressed accordingly; at least the current step is performed
+	else {
+		innerLoopMax = inner_min;
+		loop_limit = iteration - 1 + std::max(1, static_cast<int>(remaining_moves / inner_min));
+	}
+
+	if (this->logMax()) {
+		std::cout << "SA> Time budget; elapsed: " << elapsed << " s, throughput: " << moves_per_s << " moves/s";
+		std::cout << "; adapted inner-loop length: " << innerLoopMax << ", outer-loop limit: " << loop_limit << std::endl;
+	}
+}
+
+bool FloorPlanner::checkTimeBudget(std::chrono::steady_clock::time_point const& SA_start) const {
+
+	if (this->schedule.time_budget <= 0.0 ||
+			std::chrono::duration<double>(std::chrono::steady_clock::now() - SA_start).count() < this->schedule.time_budget) {
+		return false;
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Time budget of " << this->schedule.time_budget << " s reached; stop annealing" << std::endl;
+	}
+
+	return true;
+}
+
+int FloorPlanner::adaptInnerLoop(int const& innerLoopMax, double const& accepted_ops_ratio) const {
+	double factor;
+
+	// frozen chain; hardly any op is accepted, thus the length is reduced
+	// proportionally
+	if (accepted_ops_ratio < FloorPlanner::SA_ADAPTIVE_LOOP_ACCEPT_LOW) {
+		factor = accepted_ops_ratio / FloorPlanner::SA_ADAPTIVE_LOOP_ACCEPT_LOW;
+	}
+	// hot chain; random walk which reaches equilibrium quickly, thus the length is
+	// reduced proportionally w/ rising acceptance
+	else if (accepted_ops_ratio > FloorPlanner::SA_ADAPTIVE_LOOP_ACCEPT_HIGH) {
+		factor = (1.0 - accepted_ops_ratio) / (1.0 - FloorPlanner::SA_ADAPTIVE_LOOP_ACCEPT_HIGH);
+	}
+	else {
+		factor = 1.0;
+	}
+
+	factor = std::max(FloorPlanner::SA_ADAPTIVE_LOOP_MIN, factor);
+
+	return std::max(1, static_cast<int>(factor * innerLoopMax));
+}
+
+bool FloorPlanner::checkConvergence(int const& iteration, int const& iteration_first_valid_layout) const {
+	std::vector<double> avg_cost;
+	bool new_best_sol_found;
+	unsigned const steps = this->schedule.stop_steps;
+
+	// consider only steps w/ fitting layouts, i.e., SA phase two
+	if (iteration - iteration_first_valid_layout < this->schedule.stop_steps || this->tempSchedule.size() < steps) {
+		return false;
+	}
+
+	new_best_sol_found = false;
+	for (unsigned s = this->tempSchedule.size() - steps; s < this->tempSchedule.size(); s++) {
+
+		new_best_sol_found = new_best_sol_found || this->tempSchedule[s].new_best_sol_found;
+		avg_cost.push_back(this->tempSchedule[s].avg_cost);
+	}
+
+	// no improvement of best solution at low acceptance, i.e., frozen chain
+	if (!new_best_sol_found && this->tempSchedule.back().accepted_ops_ratio < FloorPlanner::SA_CONVERGENCE_ACCEPT_RATIO) {
+		return true;
+	}
+
+	// cost converged, despite reheating
+	if (Math::stdDev(avg_cost) <= FloorPlanner::SA_CONVERGENCE_STD_DEV_COST_LIMIT) {
+		return true;
+	}
+
+	return false;
+}
+
+/// criteria not considered for optimization are set to zero, i.e., they have no impact
+/// on dominance
+std::array<double, FloorPlanner::PARETO_CRITERIA> FloorPlanner::paretoCriteria(Cost const& cost) const {
+	std::array<double, FloorPlanner::PARETO_CRITERIA> criteria;
+
+	criteria.fill(0.0);
+
+	criteria[0] = cost.area_actual_value;
+	if (this->opt_flags.interconnects) {
+		criteria[1] = cost.HPWL_actual_value;
+		criteria[3] = cost.TSVs_actual_value;
+	}
+	if (this->opt_flags.routing_util) {
+		criteria[2] = cost.routing_util_actual_value;
+	}
+	if (this->opt_flags.thermal) {
+		criteria[4] = cost.thermal_actual_value;
+	}
+	if (this->opt_flags.timing || this->opt_flags.voltage_assignment) {
+		criteria[5] = cost.timing_actual_value;
+	}
+	if (this->opt_flags.alignment) {
+		criteria[6] = cost.alignments_actual_value;
+	}
+	if (this->opt_flags.thermal_leakage) {
+		criteria[7] = cost.thermal_leakage_correlation_actual_value;
+	}
+
+	return criteria;
+}
+
+/// the archive is bounded; once exceeded, the solution in the most crowded region of the
+/// front is dropped, i.e., the solution w/ the smallest crowding distance [Deb02]
+bool FloorPlanner::updateParetoArchive(CorblivarCore const& corb, Cost const& cost, int const& step) {
+	std::array<double, FloorPlanner::PARETO_CRITERIA> criteria;
+	bool less_equal, greater_equal;
+	unsigned c, i, d;
+	std::vector<double> crowding;
+	std::vector<unsigned> order;
+	double range;
+
+	criteria = this->paretoCriteria(cost);
+
+	// compare to archived solutions; drop new solution if dominated by (or equal to)
+	// any archived solution, drop archived solutions dominated by the new solution
+	for (auto it = this->paretoArchive.begin(); it != this->paretoArchive.end();) {
+
+		less_equal = greater_equal = true;
+		for (c = 0; c < FloorPlanner::PARETO_CRITERIA; c++) {
+			less_equal = less_equal && (criteria[c] <= it->criteria[c]);
+			greater_equal = greater_equal && (criteria[c] >= it->criteria[c]);
+		}
+
+		if (greater_equal) {
+			return false;
+		}
+		else if (less_equal) {
+			it = this->paretoArchive.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	// archive snapshot of new solution
+	this->paretoArchive.emplace_back(ParetoSolution());
+	ParetoSolution& solution = this->paretoArchive.back();
+
+	solution.criteria = criteria;
+	solution.step = step;
+
+	for (d = 0; d < static_cast<unsigned>(this->IC.layers); d++) {
+
+		CorblivarDie const& die = corb.getDie(d);
+
+		solution.CBLs.emplace_back(std::vector<ParetoTuple>());
+		solution.CBLs.back().reserve(die.getCBL().size());
+
+		for (i = 0; i < die.getCBL().size(); i++) {
+
+			Block const* b = die.getBlock(i);
+
+			solution.CBLs.back().push_back({
+					static_cast<unsigned>(b - this->blocks.data()),
+					die.getDirection(i),
+					die.getJunctions(i),
+					b->bb.w,
+					b->bb.h
+				});
+		}
+	}
+
+	// bound archive; drop solution w/ smallest crowding distance, boundary solutions
+	// of each criterion are kept
+	if (this->paretoArchive.size() > this->schedule.pareto_archive) {
+
+		crowding.assign(this->paretoArchive.size(), 0.0);
+		order.resize(this->paretoArchive.size());
+
+		for (c = 0; c < FloorPlanner::PARETO_CRITERIA; c++) {
+
+			for (i = 0; i < order.size(); i++) {
+				order[i] = i;
+			}
+			std::sort(order.begin(), order.end(), [&](unsigned const& a, unsigned const& b) {
+					return this->paretoArchive[a].criteria[c] < this->paretoArchive[b].criteria[c];
+				});
+
+			range = this->paretoArchive[order.back()].criteria[c] - this->paretoArchive[order.front()].criteria[c];
+			if (range == 0.0) {
+				continue;
+			}
+
+			crowding[order.front()] = crowding[order.back()] = std::numeric_limits<double>::infinity();
+
+			for (i = 1; i < order.size() - 1; i++) {
+				crowding[order[i]] += (this->paretoArchive[order[i + 1]].criteria[c] - this->paretoArchive[order[i - 1]].criteria[c]) / range;
+			}
+		}
+
+		this->paretoArchive.erase(this->paretoArchive.begin() + (std::min_element(crowding.begin(), crowding.end()) - crowding.begin()));
+	}
+
+	return true;
+}
+
+void FloorPlanner::initCorblivar(CorblivarCore& corb) {
+
+	if (this->layoutOp.parameters.partitioning_init) {
+		corb.initCorblivarPartitioned(this->logMed(), this->IC.layers, this->blocks, this->nets, this->layoutOp.parameters.power_aware_block_handling);
+	}
+	else {
+		corb.initCorblivarRandomly(this->logMed(), this->IC.layers, this->blocks, this->layoutOp.parameters.power_aware_block_handling);
+	}
+
+	if (this->layoutOp.parameters.placement_init) {
+		corb.orderCBLsByPlacement(this->logMed(), this->blocks, this->nets, this->getOutline());
+	}
+}
+
+/// refinement handler; the start temperature is derived as for regular runs by
+/// sampling the solution space, which is local around the current CBLs, but it is
+/// scaled down such that the high-temperature phase is skipped; the outer-loop limit
+/// is scaled down as well
+bool FloorPlanner::performRefinementSA(CorblivarCore& corb) {
+	bool valid_layout_found;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::performRefinementSA(" << &corb << ")" << std::endl;
+	}
+
+	auto const schedule_backup = this->schedule;
+
+	this->schedule.temp_init_factor *= FloorPlanner::SA_REFINE_TEMP_SCALE;
+	this->schedule.loop_limit = std::max(1.0, std::ceil(this->schedule.loop_limit * FloorPlanner::SA_REFINE_LOOP_SCALE));
+	// the given solution is converged already, which would trigger reheating
+	// right away; cool down instead, as for the final steps of phase 1
+	this->schedule.temp_factor_phase3 = this->schedule.temp_factor_phase1_limit;
+
+	valid_layout_found = this->performSA(corb);
+
+	this->schedule = schedule_backup;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::performRefinementSA : " << valid_layout_found << std::endl;
+	}
+
+	return valid_layout_found;
+}
+
+/// multilevel handler; the benchmark is coarsened level by level, the coarsest level
+/// is annealed w/ the regular schedule, and each finer level is refined by a short,
+/// low-temperature SA run, starting from the uncoarsened CBLs of the next-coarser
+/// level; levels where the refinement finds no fitting solution are annealed again w/
+/// the regular schedule
+bool FloorPlanner::performMultilevelSA(CorblivarCore& corb) {
+	std::unique_ptr<FloorPlanner> coarse;
+	std::unique_ptr<CorblivarCore> corb_coarse;
+	std::vector< std::vector<Block const*> > clusters;
+	std::mt19937 rand_engine_backup;
+	double time_budget;
+	std::chrono::steady_clock::time_point refine_start;
+	bool valid_layout_found;
+	unsigned long moves;
+	double SA_runtime;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::performMultilevelSA(" << &corb << ")" << std::endl;
+	}
+
+	// flat SA, also for the coarsest level; floorplacement benchmarks are always
+	// handled flat since the large blocks are to be kept in the lower left corner,
+	// see performSA
+	if (this->schedule.multilevel == 0 || this->layoutOp.parameters.floorplacement) {
+		return this->performSA(corb);
+	}
+
+	// for a resumed SA run, the checkpoint covers the refinement of this level
+	// already, thus no coarsening is required
+	if (!this->IO_conf.checkpoint_in.is_open()) {
+
+		// the constructor re-seeds the random-number generator, thus backup its
+		// state
+		rand_engine_backup = Math::randEngine();
+		coarse.reset(new FloorPlanner());
+		Math::randEngine() = rand_engine_backup;
+
+		// no further coarsening reasonable; flat SA
+		if (!this->coarsen(*coarse, clusters)) {
+			return this->performSA(corb);
+		}
+
+		if (this->logMed()) {
+			std::cout << "SA> Multilevel; coarsened " << this->blocks.size() << " blocks into " << coarse->blocks.size() << " clusters, anneal coarse level ..." << std::endl;
+			std::cout << "SA> " << std::endl;
+		}
+
+		// anneal coarse level, recursively
+		corb_coarse.reset(new CorblivarCore(coarse->IC.layers, coarse->blocks.size()));
+		coarse->initCorblivar(*corb_coarse);
+
+		// apply the best coarse solution, if any; otherwise, the last coarse
+		// solution is considered
+		if (coarse->performMultilevelSA(*corb_coarse)) {
+			corb_coarse->applyBestCBLs(false);
+		}
+
+		this->uncoarsen(corb, *corb_coarse, *coarse, clusters);
+
+		if (this->logMed()) {
+			std::cout << "SA> Multilevel; uncoarsened " << coarse->blocks.size() << " clusters into " << this->blocks.size() << " blocks, refine level ..." << std::endl;
+			std::cout << "SA> " << std::endl;
+		}
+	}
+
+	// refinement; the remaining time budget, if any, is covered by the coarser
+	// levels, see coarsen
+	time_budget = this->schedule.time_budget;
+	this->schedule.time_budget *= FloorPlanner::SA_REFINE_LOOP_SCALE;
+
+	refine_start = std::chrono::steady_clock::now();
+	valid_layout_found = this->performRefinementSA(corb);
+
+	// the refinement may not get back into the outline, i.e., it may never reach
+	// phase two, since the uncoarsened layout differs from the coarse one by the
+	// placement of clusters' blocks and since the low start temperature allows only
+	// for minor changes; fall back to the regular schedule then, starting again from
+	// the uncoarsened coarse solution; for a time budget, the fallback covers only the
+	// time left of the refinement's share
+	if (!valid_layout_found) {
+
+		if (this->schedule.time_budget > 0.0) {
+			this->schedule.time_budget -= std::chrono::duration<double>(std::chrono::steady_clock::now() - refine_start).count();
+		}
+
+		// time budget used up; keep the uncoarsened coarse solution
+		if (time_budget > 0.0 && this->schedule.time_budget <= 0.0) {
+
+			if (this->logMed()) {
+				std::cout << "SA> Multilevel; refinement found no fitting solution, time budget is used up; keep coarse solution" << std::endl;
+				std::cout << "SA> " << std::endl;
+			}
+
+			if (coarse) {
+				this->uncoarsen(corb, *corb_coarse, *coarse, clusters);
+			}
+		}
+		else {
+			if (this->logMed()) {
+				std::cout << "SA> Multilevel; refinement found no fitting solution, anneal level w/ regular schedule ..." << std::endl;
+				std::cout << "SA> " << std::endl;
+			}
+
+			moves = this->SA_stats.moves;
+			SA_runtime = this->SA_stats.SA_runtime;
+
+			if (coarse) {
+				this->uncoarsen(corb, *corb_coarse, *coarse, clusters);
+			}
+
+			valid_layout_found = this->performSA(corb);
+
+			this->SA_stats.moves += moves;
+			this->SA_stats.SA_runtime += SA_runtime;
+		}
+	}
+
+	this->schedule.time_budget = time_budget;
+
+	// statistics cover all levels
+	if (coarse) {
+		this->SA_stats.moves += coarse->SA_stats.moves;
+		this->SA_stats.SA_runtime += coarse->SA_stats.SA_runtime;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::performMultilevelSA : " << valid_layout_found << std::endl;
+	}
+
+	return valid_layout_found;
+}
+
+/// coarsening by heavy-edge matching: blocks are visited in random order and each
+/// block is paired w/ the unmatched neighbour of strongest connectivity; the rating is
+/// normalized by the pair's area, which avoids dominant clusters, and by the difference
+/// of power densities, which keeps blocks of similar power density together
+bool FloorPlanner::coarsen(FloorPlanner& coarse, std::vector< std::vector<Block const*> >& clusters) const {
+	std::vector< std::unordered_map<unsigned, double> > affinity;
+	std::vector<unsigned> order;
+	std::vector<int> cluster_ids;
+	double weight, rating, best_rating;
+	double blocks_avg_area;
+	int best;
+	unsigned a, b;
+	Point arrangement, cur_arrangement;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::coarsen(" << &coarse << ", " << &clusters << ")" << std::endl;
+	}
+
+	if (this->blocks.size() < FloorPlanner::ML_BLOCKS_MIN) {
+		return false;
+	}
+
+	// bounding box of cluster's blocks, arranged as row or as column next to the
+	// first, possibly rotated, block; the further blocks are rotated or shaped such
+	// that the bounding box grows least
+	auto arrange = [](std::vector<Block const*> const& cluster, bool const& row, bool const& rotate_first) {
+		Point bb, cur;
+		double AR, w, h;
+
+		bb.x = rotate_first ? cluster.front()->bb.h : cluster.front()->bb.w;
+		bb.y = rotate_first ? cluster.front()->bb.w : cluster.front()->bb.h;
+
+		for (unsigned b = 1; b < cluster.size(); b++) {
+
+			if (cluster[b]->soft) {
+				// shape to the height (row) or width (column) of the bounding
+				// box, w/in the AR range; note that x^2 = AR * A
+				AR = row ? cluster[b]->bb.area / (bb.y * bb.y) : (bb.x * bb.x) / cluster[b]->bb.area;
+				AR = std::min(cluster[b]->AR.max, std::max(cluster[b]->AR.min, AR));
+				w = std::sqrt(AR * cluster[b]->bb.area);
+				h = cluster[b]->bb.area / w;
+			}
+			else {
+				w = cluster[b]->bb.w;
+				h = cluster[b]->bb.h;
+			}
+
+			cur.x = row ? bb.x + w : std::max(bb.x, w);
+			cur.y = row ? std::max(bb.y, h) : bb.y + h;
+
+			// rotated hard block
+			if (!cluster[b]->soft && cluster[b]->rotatable) {
+
+				std::swap(w, h);
+
+				if ((row ? bb.x + w : std::max(bb.x, w)) * (row ? std::max(bb.y, h) : bb.y + h) < cur.x * cur.y) {
+					cur.x = row ? bb.x + w : std::max(bb.x, w);
+					cur.y = row ? std::max(bb.y, h) : bb.y + h;
+				}
+			}
+
+			bb = cur;
+		}
+
+		return bb;
+	};
+
+	// connectivity of blocks; clique model for each net, weighted by the net's degree
+	affinity.resize(this->blocks.size());
+
+	for (Net const& cur_net : this->nets) {
+
+		if (cur_net.blocks.size() < 2 || cur_net.blocks.size() > FloorPlanner::ML_NET_DEGREE_MAX) {
+			continue;
+		}
+
+		weight = 1.0 / (cur_net.blocks.size() - 1);
+
+		for (unsigned i = 0; i < cur_net.blocks.size(); i++) {
+			a = cur_net.blocks[i] - this->blocks.data();
+
+			for (unsigned j = i + 1; j < cur_net.blocks.size(); j++) {
+				b = cur_net.blocks[j] - this->blocks.data();
+
+				if (a == b) {
+					continue;
+				}
+
+				affinity[a][b] += weight;
+				affinity[b][a] += weight;
+			}
+		}
+	}
+
+	// heavy-edge matching; large blocks of floorplacement are never clustered
+	blocks_avg_area = this->IC.blocks_area / this->blocks.size();
+	cluster_ids.assign(this->blocks.size(), -1);
+
+	for (a = 0; a < this->blocks.size(); a++) {
+		order.push_back(a);
+	}
+	std::shuffle(order.begin(), order.end(), Math::randEngine());
+
+	for (unsigned cur : order) {
+
+		if (cluster_ids[cur] != -1 || this->blocks[cur].floorplacement) {
+			continue;
+		}
+
+		best = -1;
+		best_rating = 0.0;
+
+		for (auto const& neighbour : affinity[cur]) {
+
+			if (cluster_ids[neighbour.first] != -1 || this->blocks[neighbour.first].floorplacement) {
+				continue;
+			}
+
+			rating = neighbour.second / ((this->blocks[cur].bb.area + this->blocks[neighbour.first].bb.area) / blocks_avg_area);
+
+			if (this->power_stats.range > 0.0) {
+				rating /= 1.0 + std::abs(this->blocks[cur].power_density() - this->blocks[neighbour.first].power_density()) / this->power_stats.range;
+			}
+
+			if (rating > best_rating) {
+				best_rating = rating;
+				best = neighbour.first;
+			}
+		}
+
+		if (best != -1) {
+			cluster_ids[cur] = cluster_ids[best] = clusters.size();
+			clusters.push_back({&this->blocks[cur], &this->blocks[best]});
+		}
+	}
+
+	// unmatched blocks remain as is
+	for (a = 0; a < this->blocks.size(); a++) {
+
+		if (cluster_ids[a] == -1) {
+			cluster_ids[a] = clusters.size();
+			clusters.push_back({&this->blocks[a]});
+		}
+	}
+
+	if (clusters.size() > FloorPlanner::ML_CLUSTERS_RATIO_MAX * this->blocks.size()) {
+		clusters.clear();
+		return false;
+	}
+
+	// replicate the configuration; the coarse level is optimized only for packing
+	// and interconnects
+	coarse.replicateConfig(*this);
+	coarse.thermal_analyser_run = false;
+	coarse.schedule.multilevel = this->schedule.multilevel - 1;
+	coarse.schedule.time_budget = this->schedule.time_budget * (1.0 - FloorPlanner::SA_REFINE_LOOP_SCALE);
+	coarse.schedule.speculative_moves = 0;
+	coarse.schedule.sampling_walks = 0;
+	coarse.schedule.pareto_archive = 0;
+	coarse.opt_flags.thermal = coarse.opt_flags.routing_util = coarse.opt_flags.alignment = coarse.opt_flags.alignment_WL_estimate = false;
+	coarse.opt_flags.voltage_assignment = coarse.opt_flags.timing = coarse.opt_flags.thermal_leakage = false;
+	coarse.power_stats = this->power_stats;
+	coarse.layoutOp.parameters.opt_alignment = false;
+	coarse.layoutOp.parameters.shrink_die = false;
+	coarse.layoutOp.parameters.signal_TSV_clustering = false;
+	coarse.layoutOp.parameters.largest_net = nullptr;
+
+	// coarse blocks; clusters of multiple blocks are handled as soft blocks
+	coarse.blocks.reserve(clusters.size());
+
+	for (std::vector<Block const*>& cluster : clusters) {
+
+		// larger blocks first, see uncoarsen
+		std::sort(cluster.begin(), cluster.end(),
+			[](Block const* b1, Block const* b2) {
+				return (b1->numerical_id != b2->numerical_id) && (b1->bb.area > b2->bb.area);
+			}
+		);
+
+		// copy of the largest block; this way, the voltage and delay factors
+		// are inherited as well
+		Block cluster_block = *cluster.front();
+		cluster_block.numerical_id = coarse.blocks.size();
+		cluster_block.alignments_vertical_bus.clear();
+
+		if (cluster.size() > 1) {
+
+			// the level is part of the id, such that the ids are unique also
+			// for clusters kept as is from finer levels; blocks are retrieved by
+			// their id, e.g., in CorblivarCore::initCorblivarRandomly
+			cluster_block.id = "ml_cluster_" + std::to_string(this->schedule.multilevel) + "_" + std::to_string(coarse.blocks.size());
+			cluster_block.bb.area = cluster_block.power_density_unscaled = 0.0;
+
+			for (Block const* cur_block : cluster) {
+				cluster_block.bb.area += cur_block->bb.area;
+				cluster_block.power_density_unscaled += cur_block->power_density_unscaled * cur_block->bb.area;
+			}
+			cluster_block.power_density_unscaled /= cluster_block.bb.area;
+			cluster_block.power_density_unscaled_back = cluster_block.power_density_unscaled;
+
+			// clusters of soft blocks only are handled as soft blocks
+			if (std::all_of(cluster.begin(), cluster.end(), [](Block const* b) {return b->soft;})) {
+
+				cluster_block.soft = cluster_block.rotatable = true;
+				cluster_block.AR.min = FloorPlanner::ML_CLUSTER_AR_MIN;
+				cluster_block.AR.max = FloorPlanner::ML_CLUSTER_AR_MAX;
+				cluster_block.shapeRandomlyByAR();
+			}
+			// clusters w/ hard blocks cannot be shaped freely; they are handled
+			// as hard blocks, shaped by the bounding box of the best arrangement
+			// of their blocks, i.e., including the whitespace inherent to the
+			// cluster; this way, the coarse solution can be uncoarsened w/o
+			// violating the outline, see uncoarsen
+			else {
+				arrangement = arrange(cluster, true, false);
+
+				for (bool row : {true, false}) {
+					for (bool rotate_first : {false, true}) {
+
+						if (rotate_first && !cluster.front()->rotatable) {
+							continue;
+						}
+
+						cur_arrangement = arrange(cluster, row, rotate_first);
+
+						if (cur_arrangement.x * cur_arrangement.y < arrangement.x * arrangement.y) {
+							arrangement = cur_arrangement;
+						}
+					}
+				}
+
+				cluster_block.power_density_unscaled *= cluster_block.bb.area / (arrangement.x * arrangement.y);
+				cluster_block.power_density_unscaled_back = cluster_block.power_density_unscaled;
+
+				cluster_block.soft = false;
+				cluster_block.rotatable = std::all_of(cluster.begin(), cluster.end(), [](Block const* b) {return b->rotatable;});
+				cluster_block.AR.min = cluster_block.AR.max = arrangement.x / arrangement.y;
+				cluster_block.bb.w = arrangement.x;
+				cluster_block.bb.h = arrangement.y;
+				cluster_block.bb.area = arrangement.x * arrangement.y;
+				cluster_block.bb.ur.x = cluster_block.bb.ll.x + cluster_block.bb.w;
+				cluster_block.bb.ur.y = cluster_block.bb.ll.y + cluster_block.bb.h;
+			}
+		}
+
+		coarse.blocks.push_back(std::move(cluster_block));
+	}
+
+	// terminal pins, w/ their current scaling
+	coarse.terminals = this->terminals;
+
+	// coarse nets; nets within clusters are dropped
+	for (Net const& cur_net : this->nets) {
+
+		Net coarse_net = Net(cur_net.id);
+		coarse_net.hasExternalPin = cur_net.hasExternalPin;
+		coarse_net.inputNet = cur_net.inputNet;
+		coarse_net.outputNet = cur_net.outputNet;
+
+		for (Block const* cur_block : cur_net.blocks) {
+
+			Block const* cluster_block = &coarse.blocks[cluster_ids[cur_block - this->blocks.data()]];
+
+			if (std::find(coarse_net.blocks.begin(), coarse_net.blocks.end(), cluster_block) == coarse_net.blocks.end()) {
+				coarse_net.blocks.push_back(cluster_block);
+			}
+		}
+		for (Pin const* pin : cur_net.terminals) {
+			coarse_net.terminals.push_back(&coarse.terminals[pin - this->terminals.data()]);
+		}
+
+		if (coarse_net.blocks.size() + coarse_net.terminals.size() < 2) {
+			continue;
+		}
+
+		if (cur_net.source != nullptr) {
+			coarse_net.source = &coarse.blocks[cluster_ids[cur_net.source - this->blocks.data()]];
+		}
+
+		coarse.nets.push_back(std::move(coarse_net));
+	}
+
+	coarse.initThermalAnalyzer();
+	coarse.initRoutingUtilAnalyzer();
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::coarsen : " << clusters.size() << std::endl;
+	}
+
+	return true;
+}
+
+/// uncoarsening; each cluster tuple is expanded into the tuples of the cluster's
+/// blocks, on the same die; the first block inherits the cluster tuple, the remaining
+/// blocks are placed next to it, as row or as column; the blocks are re-packed w/in the
+/// cluster's bounding box, such that the refinement starts from the coarse layout, not
+/// from a layout blown up by arbitrarily arranged blocks
+void FloorPlanner::uncoarsen(CorblivarCore& corb, CorblivarCore const& corb_coarse, FloorPlanner const& coarse,
+		std::vector< std::vector<Block const*> > const& clusters) const {
+	double cluster_area, row_w, row_h, col_w, col_h;
+	bool row;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::uncoarsen(" << &corb << ", " << &corb_coarse << ", " << &coarse << ", " << &clusters << ")" << std::endl;
+	}
+
+	// shape block to fit best into the given slice of the cluster's bounding box;
+	// soft blocks are shaped w/in their AR range, hard blocks are rotated if that
+	// fits better
+	auto shape = [](Block const* block, double const& slice_w, double const& slice_h) {
+		double AR, w;
+
+		if (block->soft) {
+			AR = std::min(block->AR.max, std::max(block->AR.min, slice_w / slice_h));
+			w = std::sqrt(AR * block->bb.area);
+
+			block->shapeByWidthHeight(w, block->bb.area / w);
+		}
+		else if (std::max(block->bb.h / slice_w, block->bb.w / slice_h) < std::max(block->bb.w / slice_w, block->bb.h / slice_h)) {
+			block->rotate();
+		}
+	};
+
+	for (int d = 0; d < this->IC.layers; d++) {
+
+		CorblivarDie const& die_coarse = corb_coarse.getDie(d);
+		CornerBlockList& CBL = corb.editDie(d).editCBL();
+
+		CBL.clear();
+
+		for (unsigned t = 0; t < die_coarse.getCBL().size(); t++) {
+
+			Block const* cluster_block = die_coarse.getBlock(t);
+			std::vector<Block const*> const& cluster = clusters[cluster_block - coarse.blocks.data()];
+			Rect const& bb = cluster_block->bb;
+
+			// a single block may have been rotated or shaped on the coarse level
+			if (cluster.size() == 1) {
+				cluster.front()->bb = bb;
+			}
+
+			// multiple blocks; each block is shaped for its share of the bounding
+			// box, for a row and for a column of blocks; the arrangement which
+			// requires less scaling to fit into the bounding box is applied; note
+			// that the bounding box of clusters w/ hard blocks covers whitespace,
+			// see coarsen, thus the shares relate to the blocks' area
+			row = false;
+
+			if (cluster.size() > 1) {
+
+				cluster_area = row_w = row_h = col_w = col_h = 0.0;
+
+				for (Block const* cur_block : cluster) {
+					cluster_area += cur_block->bb.area;
+				}
+
+				for (Block const* cur_block : cluster) {
+
+					shape(cur_block, bb.w * cur_block->bb.area / cluster_area, bb.h);
+
+					row_w += cur_block->bb.w;
+					row_h = std::max(row_h, cur_block->bb.h);
+				}
+				for (Block const* cur_block : cluster) {
+
+					shape(cur_block, bb.w, bb.h * cur_block->bb.area / cluster_area);
+
+					col_w = std::max(col_w, cur_block->bb.w);
+					col_h += cur_block->bb.h;
+				}
+
+				row = std::max(row_w / bb.w, row_h / bb.h) < std::max(col_w / bb.w, col_h / bb.h);
+
+				if (row) {
+					for (Block const* cur_block : cluster) {
+						shape(cur_block, bb.w * cur_block->bb.area / cluster_area, bb.h);
+					}
+				}
+			}
+
+			for (unsigned b = 0; b < cluster.size(); b++) {
+
+				cluster[b]->layer = d;
+
+				// the remaining blocks cover only their predecessor, i.e., the
+				// current corner block; horizontal insertion places them right
+				// of it, vertical insertion above it
+				if (b == 0) {
+					CBL.insert({cluster[b], die_coarse.getDirection(t), die_coarse.getJunctions(t)});
+				}
+				else {
+					CBL.insert({cluster[b], row ? Direction::HORIZONTAL : Direction::VERTICAL, 0});
+				}
+			}
+		}
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::uncoarsen" << std::endl;
+	}
+}
+
+FloorPlanner::~FloorPlanner() {
+	this->stopWorkers();
+}
+
+void FloorPlanner::replicateConfig(FloorPlanner const& setup) {
+
+	this->log = setup.log;
+	this->benchmark = setup.benchmark;
+	this->thermal_analyser_run = setup.thermal_analyser_run;
+	this->IC = setup.IC;
+	this->techParameters = setup.techParameters;
+	this->schedule = setup.schedule;
+	this->opt_flags = setup.opt_flags;
+	this->weights = setup.weights;
+	this->power_blurring_parameters = setup.power_blurring_parameters;
+	this->layoutOp.parameters = setup.layoutOp.parameters;
+	this->voltageAssignment.parameters = setup.voltageAssignment.parameters;
+	this->leakageAnalyzer.parameters = setup.leakageAnalyzer.parameters;
+	this->IO_conf.output_dir = setup.IO_conf.output_dir;
+	this->IO_conf.blocks_file = setup.IO_conf.blocks_file;
+	this->IO_conf.GT_fp_file = setup.IO_conf.GT_fp_file;
+	this->IO_conf.alignments_file = setup.IO_conf.alignments_file;
+	this->IO_conf.pins_file = setup.IO_conf.pins_file;
+	this->IO_conf.GT_pins_file = setup.IO_conf.GT_pins_file;
+	this->IO_conf.power_density_file = setup.IO_conf.power_density_file;
+	this->IO_conf.GT_power_file = setup.IO_conf.GT_power_file;
+	this->IO_conf.nets_file = setup.IO_conf.nets_file;
+	this->IO_conf.power_density_file_avail = setup.IO_conf.power_density_file_avail;
+	this->IO_conf.alignments_file_avail = setup.IO_conf.alignments_file_avail;
+	this->IO_conf.GT_benchmark = setup.IO_conf.GT_benchmark;
+}
+
+void FloorPlanner::replicateBenchmark(FloorPlanner const& setup, std::vector<CorblivarAlignmentReq> const& alignments_setup,
+		std::vector<CorblivarAlignmentReq>& alignments) {
+
+	// the block of this floorplanner related to the given block of the setup;
+	// also covers the reference block
+	auto block = [&](Block const* b) -> Block const* {
+
+		if (b == &setup.RBOD) {
+			return &this->RBOD;
+		}
+		else {
+			return &this->blocks[b - setup.blocks.data()];
+		}
+	};
+
+	// blocks; links to other blocks, alignment requests, and voltage modules are
+	// dropped, they are re-determined for each layout or re-linked below
+	this->blocks = setup.blocks;
+	for (Block& b : this->blocks) {
+		b.alignments_vertical_bus.clear();
+		b.contiguous_neighbours.clear();
+		b.assigned_module = nullptr;
+	}
+	this->power_stats = setup.power_stats;
+
+	// terminal pins, w/ their current scaling
+	this->terminals = setup.terminals;
+
+	// nets
+	this->nets = setup.nets;
+	for (Net& net : this->nets) {
+
+		for (Block const*& b : net.blocks) {
+			b = block(b);
+		}
+		for (Pin const*& pin : net.terminals) {
+			pin = &this->terminals[pin - setup.terminals.data()];
+		}
+		if (net.source != nullptr) {
+			net.source = block(net.source);
+		}
+	}
+
+	if (setup.layoutOp.parameters.largest_net == nullptr) {
+		this->layoutOp.parameters.largest_net = nullptr;
+	}
+	else {
+		this->layoutOp.parameters.largest_net = &this->nets[setup.layoutOp.parameters.largest_net - setup.nets.data()];
+	}
+
+	// alignment requests; the pointers to vertical-bus requests are linked only
+	// after all requests are copied, as in IO::parseAlignmentRequests
+	alignments = alignments_setup;
+	for (CorblivarAlignmentReq& req : alignments) {
+		req.s_i = block(req.s_i);
+		req.s_j = block(req.s_j);
+	}
+	for (CorblivarAlignmentReq& req : alignments) {
+
+		if (req.vertical_bus()) {
+
+			if (req.s_i != &this->RBOD) {
+				req.s_i->alignments_vertical_bus.push_back(&req);
+			}
+
+			if (req.s_j != &this->RBOD) {
+				req.s_j->alignments_vertical_bus.push_back(&req);
+			}
+		}
+	}
+}
+
+void FloorPlanner::initWorkers(CorblivarCore const& corb, unsigned const& count) {
+	std::mt19937 rand_engine_backup;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "-> FloorPlanner::initWorkers(" << &corb << ", " << count << ")" << std::endl;
+	}
+
+	// the constructor of replicas re-seeds the random-number generator of the
+	// main thread, thus backup its state
+	rand_engine_backup = Math::randEngine();
+
+	if (this->logMed()) {
+		std::cout << "SA> Init " << count << " replicas and worker threads for speculative moves / parallel sampling ..." << std::endl;
+	}
+
+	this->speculation.candidates.resize(count);
+
+	for (SpeculativeCandidate& candidate : this->speculation.candidates) {
+
+		candidate.fp.reset(new FloorPlanner());
+		FloorPlanner& fp = *candidate.fp;
+
+		// replicate the configuration; replicas are not logging
+		fp.replicateConfig(*this);
+		fp.log = 0;
+		fp.schedule.speculative_moves = 0;
+		fp.schedule.sampling_walks = 0;
+
+		// replicate the benchmark, such that each replica holds its own
+		// blocks, nets, and alignment requests; the benchmark is not parsed
+		// again, it may also be given via the API w/o any files
+		candidate.corb.reset(new CorblivarCore(fp.IC.layers, this->blocks.size()));
+		fp.replicateBenchmark(*this, corb.getAlignments(), candidate.corb->editAlignments());
+		fp.initTimingPowerAnalyser();
+
+		// the die outline may be adapted already, e.g., for a resumed SA
+		// run; the analyzers are initialized for the current outline
+		fp.initThermalAnalyzer();
+		fp.initRoutingUtilAnalyzer();
+	}
+
+	Math::randEngine() = rand_engine_backup;
+
+	// start worker threads, one for each candidate
+	for (unsigned candidate = 0; candidate < this->speculation.candidates.size(); candidate++) {
+		this->speculation.workers.emplace_back(&FloorPlanner::workerHandler, this, candidate);
+	}
+
+	if (this->logMed()) {
+		std::cout << "SA> Done" << std::endl;
+		std::cout << "SA> " << std::endl;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		std::cout << "<- FloorPlanner::initWorkers" << std::endl;
+	}
+}
+
+void FloorPlanner::stopWorkers() {
+
+	if (this->speculation.workers.empty()) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->speculation.mutex);
+		this->speculation.stop = true;
+	}
+	this->speculation.batch_start.notify_all();
+
+	for (std::thread& worker : this->speculation.workers) {
+		worker.join();
+	}
+
+	this->speculation.workers.clear();
+	this->speculation.candidates.clear();
+	this->speculation.stop = false;
+}
+
+void FloorPlanner::updateSpeculativeOpStats(bool const& SA_phase_two, double const& cur_cost, unsigned const& candidates) {
+
+	// all candidates w/ successful op ahead of the given index are rejected ones,
+	// see FloorPlanner::performSA
+	for (unsigned k = 0; k < candidates; k++) {
+
+		SpeculativeCandidate const& candidate = this->speculation.candidates[k];
+
+		if (candidate.op_success) {
+			this->layoutOp.updateOpStats(candidate.op, SA_phase_two, cur_cost, candidate.cost_diff, false, candidate.runtime);
+		}
+	}
+}
+
+void FloorPlanner::evaluateCandidateMoves(CorblivarCore const& corb, double const& cur_cost, double const& temp, double const& fitting_layouts_ratio,
+		int const& layout_fit_counter, bool const& cooling_phase_three) {
+
+	// the seeds for the candidates are drawn by the main thread, such that the SA
+	// run is reproducible for a fixed seed, independent of the thread scheduling
+	for (SpeculativeCandidate& candidate : this->speculation.candidates) {
+		candidate.seed = Math::randEngine()();
+	}
+
+	this->speculation.size = this->schedule.speculative_moves;
+	this->speculation.sampling = false;
+	this->speculation.corb = &corb;
+	this->speculation.cur_cost = cur_cost;
+	this->speculation.temp = temp;
+	this->speculation.fitting_layouts_ratio = fitting_layouts_ratio;
+	this->speculation.layout_fit_counter = layout_fit_counter;
+	this->speculation.cooling_phase_three = cooling_phase_three;
+
+	this->runWorkers();
+}
+
+void FloorPlanner::runWorkers() {
 
-				// after phase transition, skip current global iteration
-				// in order to consider updated cost function
-				if (SA_phase_two_init) {
-					break;
-				}
-				// consider next loop iteration
-				else {
-					ii++;
-				}
-			}
-		}
+	// trigger workers; the parameters of the batch are published by the lock
+	{
+		std::lock_guard<std::mutex> lock(this->speculation.mutex);
 
-		// determine ratio of solutions fitting into outline in current temp step;
-		// note that during the next temp step this ratio is fixed in order to
-		// avoid sudden changes of related cost terms during few iterations
-		if (accepted_ops > 0) {
-			fitting_layouts_ratio = static_cast<double>(layout_fit_counter) / accepted_ops;
-		}
-		else {
-			fitting_layouts_ratio = 0.0;
-		}
+		this->speculation.done = 0;
+		this->speculation.batch++;
+	}
+	this->speculation.batch_start.notify_all();
 
-		// determine avg cost for temp step
-		if (accepted_ops > 0) {
-			avg_cost /= accepted_ops;
-		}
+	// wait for all candidates
+	{
+		std::unique_lock<std::mutex> lock(this->speculation.mutex);
 
-		// determine accepted-ops ratio
-		accepted_ops_ratio = static_cast<double>(accepted_ops) / ii;
+		this->speculation.batch_done.wait(lock, [&]() {
+				return this->speculation.done == this->speculation.candidates.size();
+			});
+	}
+}
 
-		if (this->logMax()) {
-			std::cout << "SA> Step done:" << std::endl;
-			std::cout << "SA>  New best solution found: " << best_sol_found << std::endl;
+void FloorPlanner::workerHandler(unsigned const& candidate) {
+	unsigned long batch = 0;
 
-			// log details for current best solution; first, backup current
-			// (most likely not that particular best new solution)
-			corb.backupCBLs();
+	while (true) {
 
-			// apply best new solution, no logging in case no best solution is
-			// found yet
-			corb.applyBestCBLs(false);
-			this->generateLayout(corb, this->opt_flags.alignment);
+		// wait for next batch, or for termination
+		{
+			std::unique_lock<std::mutex> lock(this->speculation.mutex);
 
-			// enable voltage assignment based on initial threshold value, but also backup current threshold
-			double cur_threshold = this->IC.delay_threshold;
-			this->IC.delay_threshold = this->IC.delay_threshold_initial;
+			this->speculation.batch_start.wait(lock, [&]() {
+					return this->speculation.stop || this->speculation.batch != batch;
+				});
 
-			// determine cost terms and overall cost for new best solution;
-			// assume fitting ratio of 1.0 for better comparability of
-			// different solutions and their cost
-			cost = this->evaluateLayout(corb.getAlignments(), 1.0, SA_phase_two);
+			if (this->speculation.stop) {
+				return;
+			}
 
-			// restore current threshold
-			this->IC.delay_threshold = cur_threshold;
+			batch = this->speculation.batch;
+		}
 
-			if (SA_phase_two) {
-				std::cout << "SA>   Current best solution; overall cost: " << cost.total_cost << std::endl;
+		// workers beyond the size of the batch remain idle
+		if (candidate < this->speculation.size) {
+
+			if (this->speculation.sampling) {
+				this->sampleSolutionSpace(this->speculation.candidates[candidate]);
 			}
 			else {
-				std::cout << "SA>   Current solution, not fitting yet into the outline; overall cost: " << cost.total_cost << std::endl;
+				this->evaluateCandidateMove(this->speculation.candidates[candidate]);
 			}
-			// always log the current state for fitting the blocks into the
-			// fixed outline
-			std::cout << "SA>    Current max AR mismatch (ideal value is 0.0): " << cost.outline_actual_value << std::endl;
-			std::cout << "SA>    Current max packing overhead (ideal value is 0.0): " << cost.area_actual_value << std::endl;
+		}
 
-			// log other more detailed cost term only for phase two
-			if (SA_phase_two) {
+		{
+			std::lock_guard<std::mutex> lock(this->speculation.mutex);
+			this->speculation.done++;
+		}
+		this->speculation.batch_done.notify_one();
+	}
+}
 
-				if (this->opt_flags.alignment) {
-					std::cout << "SA>    Alignment mismatches [um]: " << cost.alignments_actual_value << std::endl;
-				}
+void FloorPlanner::evaluateCandidateMove(SpeculativeCandidate& candidate) const {
+	FloorPlanner& fp = *candidate.fp;
+	CorblivarCore& corb = *candidate.corb;
+	std::chrono::steady_clock::time_point start;
 
-				std::cout << "SA>    Total power for blocks, wires and TSVs [W]: " << cost.power_blocks + cost.power_wires + cost.power_TSVs << std::endl;
-				std::cout << "SA>    HPWL: " << cost.HPWL_actual_value << std::endl;
+	// derive candidate from current layout; the main thread is waiting meanwhile,
+	// i.e., its data is not altered
+	this->syncReplica(fp, corb, *this->speculation.corb);
 
-				if (this->opt_flags.routing_util) {
-					std::cout << "SA>    Max routing utilization: " << cost.routing_util_actual_value << std::endl;
-				}
+	// seed the random-number generator of this worker thread; the same seed
+	// reproduces the same move in the main thread, see FloorPlanner::performSA
+	Math::seed(candidate.seed);
 
-				if (this->opt_flags.thermal) {
-					std::cout << "SA>    Temp (estimated max temp for lowest layer [K]): " << cost.thermal_actual_value << std::endl;
-				}
+	start = std::chrono::steady_clock::now();
 
-				if (this->opt_flags.timing || this->opt_flags.voltage_assignment) {
+	candidate.accept = false;
+	candidate.op_success = fp.layoutOp.performLayoutOp(corb, this->speculation.layout_fit_counter, true, false, this->speculation.cooling_phase_three);
 
-					std::cout << "SA>    Timing (max delay [ns]): " << cost.timing_actual_value << std::endl;
-					// always display violation, also when it's negative
-					// (i.e., timing better than constraint)
-					std::cout << "SA>     Timing violation ([ns] / [%]): ";
-					std::cout << cost.timing_actual_value - this->IC.delay_threshold;
-					std::cout << " / ";
-					std::cout << cost.timing_actual_value * (100.0 / this->IC.delay_threshold) - 100.0;
-					std::cout << std::endl;
-					// is adapted dynamically for voltage assignment
-					std::cout << "SA>      Current timing threshold: " << this->IC.delay_threshold << std::endl;
-				}
+	if (!candidate.op_success) {
+		return;
+	}
 
-				// TODO add level shifter, avg corners; plot all only when according weight is defined
-				if (this->opt_flags.voltage_assignment) {
+	candidate.op = fp.layoutOp.lastOp();
 
-					std::cout << "SA>    Voltage assignment; power reduction for blocks [W]: " << cost.voltage_assignment_power_saving << std::endl;
-					std::cout << "SA>    Voltage assignment; volume count: " << cost.voltage_assignment_modules_count << std::endl;
-					std::cout << "SA>    Voltage assignment; max std dev of power densities: " << cost.voltage_assignment_power_variation_max << std::endl;
-				}
+	fp.generateLayout(corb, fp.opt_flags.alignment);
+	candidate.cost_diff = fp.evaluateLayout(corb.getAlignments(), this->speculation.fitting_layouts_ratio, true).total_cost - this->speculation.cur_cost;
 
-				if (this->opt_flags.thermal_leakage) {
+	// same acceptance criterion as in FloorPlanner::performSA
+	candidate.accept = true;
+	if (candidate.cost_diff >= 0.0) {
+		if (Math::randF(0, 1) > exp(- candidate.cost_diff / this->speculation.temp)) {
+			candidate.accept = false;
+		}
+	}
 
-					std::cout << "SA>    Thermal leakage; avg spatial entropy of power maps: " << cost.thermal_leakage_entropy_actual_value << std::endl;
-					std::cout << "SA>    Thermal leakage; Pearson correlation of power and thermal map for lowest layer: " << cost.thermal_leakage_correlation_actual_value << std::endl;
-				}
-			}
+	candidate.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
 
-			std::cout << "SA>  Accept-ops ratio: " << accepted_ops_ratio << std::endl;
-			std::cout << "SA>  Valid-layouts ratio: " << fitting_layouts_ratio << std::endl;
-			std::cout << "SA>  Avg cost: " << avg_cost << std::endl;
-			std::cout << "SA>  SA temp: " << cur_temp << std::endl;
+void FloorPlanner::sampleSolutionSpace(SpeculativeCandidate& candidate) const {
+	FloorPlanner& fp = *candidate.fp;
+	CorblivarCore& corb = *candidate.corb;
+	int i;
+	double cur_cost, prev_cost;
 
-			// finally, restore previous layout
-			corb.restoreCBLs();
-		}
+	// all random walks start from the initial layout
+	this->syncReplica(fp, corb, *this->speculation.corb);
 
-		// log temperature step
-		TempStep cur_step;
-		cur_step.step = i;
-		cur_step.temp = cur_temp;
-		cur_step.avg_cost = avg_cost;
-		cur_step.new_best_sol_found = best_sol_found;
-		cur_step.cost_best_sol = best_cost;
-		this->tempSchedule.push_back(std::move(cur_step));
+	// seed the random-number generator of this worker thread
+	Math::seed(candidate.seed);
 
-		// update SA temperature
-		cooling_phase = this->updateTemp(cur_temp, i, i_valid_layout_found);
+	candidate.cost_samples.clear();
+	candidate.cost_samples.reserve(this->speculation.sampling_steps);
 
-		// consider next outer step
-		i++;
-	}
+	// same random walk as in FloorPlanner::initSA
+	fp.generateLayout(corb);
+	cur_cost = fp.evaluateLayout(corb.getAlignments()).total_cost;
 
-	if (this->logMed()) {
-		std::cout << "SA> Done" << std::endl;
-		std::cout << std::endl;
-	}
+	i = 1;
+	while (i <= this->speculation.sampling_steps) {
 
-	if (FloorPlanner::DBG_CALLS_SA) {
-		std::cout << "<- FloorPlanner::performSA : " << valid_layout_found << std::endl;
-	}
+		if (fp.layoutOp.performLayoutOp(corb, 1)) {
 
-	return valid_layout_found;
-}
+			prev_cost = cur_cost;
 
-FloorPlanner::TempPhase FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const {
-	float loop_factor;
-	double prev_temp;
-	TempPhase phase;
-	std::vector<double> prev_avg_cost;
-	double std_dev_avg_cost;
-	unsigned i, temp_schedule_size;
+			fp.generateLayout(corb);
+			cur_cost = fp.evaluateLayout(corb.getAlignments()).total_cost;
 
-	prev_temp = cur_temp;
+			// solution w/ worse cost, revert
+			if (cur_cost - prev_cost > 0.0) {
+				fp.layoutOp.performLayoutOp(corb, 1, false, true);
+				cur_cost = prev_cost;
+			}
 
-	// consider reheating in case the SA search has converged in some (possibly local) minima
-	//
-	// determine std dev of avg cost if some previous temperature steps exist
-	temp_schedule_size = this->tempSchedule.size();
-	if (temp_schedule_size >= FloorPlanner::SA_REHEAT_COST_SAMPLES) {
+			candidate.cost_samples.push_back(cur_cost);
 
-		for (i = 1; i <= FloorPlanner::SA_REHEAT_COST_SAMPLES; i++) {
-			prev_avg_cost.push_back(this->tempSchedule[temp_schedule_size - i].avg_cost);
+			i++;
 		}
+	}
+}
 
-		std_dev_avg_cost = Math::stdDev(prev_avg_cost);
+void FloorPlanner::syncReplica(FloorPlanner& fp, CorblivarCore& corb, CorblivarCore const& corb_master) const {
+	bool outline_changed;
+
+	// die outline, possibly shrunk, and dynamically adapted timing threshold; the
+	// power maps and the routing-estimation maps have to be re-targeted for a
+	// changed outline, see FloorPlanner::shrinkDieOutlines
+	outline_changed = (fp.IC.outline_x != this->IC.outline_x || fp.IC.outline_y != this->IC.outline_y);
+	fp.IC = this->IC;
+	if (outline_changed) {
+		fp.thermalAnalyzer.scalePowerMaps(fp.getOutline());
+		fp.routingUtil.scaleUtilMaps(fp.getOutline());
+	}
+
+	// max-cost normalizers
+	fp.max_cost_thermal = this->max_cost_thermal;
+	fp.max_cost_WL = this->max_cost_WL;
+	fp.max_cost_alignments = this->max_cost_alignments;
+	fp.max_cost_routing_util = this->max_cost_routing_util;
+	fp.max_cost_timing = this->max_cost_timing;
+	fp.max_cost_voltage_assignment = this->max_cost_voltage_assignment;
+	fp.max_cost_thermal_leakage = this->max_cost_thermal_leakage;
+	fp.max_cost_TSVs = this->max_cost_TSVs;
+	fp.voltageAssignment.max_values = this->voltageAssignment.max_values;
+	fp.leakageAnalyzer.max_values = this->leakageAnalyzer.max_values;
+
+	// block-selection guidance and statistics of layout operations
+	if (this->layoutOp.parameters.largest_net == nullptr) {
+		fp.layoutOp.parameters.largest_net = nullptr;
 	}
-	// else ignore std dev by setting it above limit
 	else {
-		std_dev_avg_cost = FloorPlanner::SA_REHEAT_STD_DEV_COST_LIMIT + 1;
+		fp.layoutOp.parameters.largest_net = &fp.nets[this->layoutOp.parameters.largest_net - this->nets.data()];
 	}
+	fp.layoutOp.op_stats = this->layoutOp.op_stats;
 
-	// phase 3; brief reheating due to cost convergence
-	if (std_dev_avg_cost <= FloorPlanner::SA_REHEAT_STD_DEV_COST_LIMIT) {
-
-		cur_temp *= this->schedule.temp_factor_phase3;
+	// terminal pins, possibly scaled
+	for (unsigned p = 0; p < this->terminals.size(); p++) {
+		fp.terminals[p].bb = this->terminals[p].bb;
+	}
 
-		phase = TempPhase::PHASE_3;
+	// block shapes and placement of the current layout; the latter is considered
+	// by some layout operations
+	for (unsigned b = 0; b < this->blocks.size(); b++) {
+		fp.blocks[b].bb = this->blocks[b].bb;
+		fp.blocks[b].alignment = this->blocks[b].alignment;
 	}
-	// phase 1; adaptive cooling (slows down from schedule.temp_factor_phase1 to
-	// schedule.temp_factor_phase1_limit)
-	else if (iteration_first_valid_layout == Point::UNDEF) {
 
-		loop_factor = (this->schedule.temp_factor_phase1_limit - this->schedule.temp_factor_phase1) *
-			static_cast<float>(iteration - 1) / (this->schedule.loop_limit - 1.0);
+	// CBLs; also memorize layer in blocks
+	for (int d = 0; d < this->IC.layers; d++) {
 
-		// note that loop_factor is additive in this case; the cooling factor is
-		// increased w/ increasing iterations
-		cur_temp *= this->schedule.temp_factor_phase1 + loop_factor;
+		CornerBlockList& CBL = corb.editDie(d).editCBL();
 
-		phase = TempPhase::PHASE_1;
+		CBL.assign(corb_master.getDie(d).getCBL(), this->blocks, fp.blocks);
+
+		for (Block const* b : corb.getDie(d).getBlocks()) {
+			b->layer = d;
+		}
 	}
-	// phase 2; reheating and converging (initially reheats and then increases cooling
-	// rate faster, i.e., heating factor is decreased w/ increasing iterations to
-	// enable convergence)
-	else {
-		// note that loop_factor must only consider the remaining iteration range
-		loop_factor = 1.0 - static_cast<float>(iteration - iteration_first_valid_layout) /
-			static_cast<float>(this->schedule.loop_limit - iteration_first_valid_layout);
 
-		cur_temp *= this->schedule.temp_factor_phase2 * loop_factor;
+	// alignment requests, which are altered by some layout operations, along w/
+	// their status
+	for (unsigned r = 0; r < corb_master.getAlignments().size(); r++) {
 
-		phase = TempPhase::PHASE_2;
-	}
+		CorblivarAlignmentReq const& req_master = corb_master.getAlignments()[r];
+		CorblivarAlignmentReq& req = corb.editAlignments()[r];
 
-	if (this->logMax()) {
-		std::cout << "SA>  (new) temp-update factor: " << cur_temp / prev_temp << " (phase " << phase << ")" << std::endl;
+		req.type_x = req_master.type_x;
+		req.type_y = req_master.type_y;
+		req.alignment_x = req_master.alignment_x;
+		req.alignment_y = req_master.alignment_y;
+		req.fulfilled = req_master.fulfilled;
 	}
-
-	return phase;
 }
 
 void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp) {
@@ -539,6 +2087,8 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 	int accepted_ops;
 	bool op_success;
 	double cur_cost, prev_cost, cost_diff;
+	int samples;
+	double std_dev, confidence;
 
 	// reset max cost
 	this->max_cost_WL = 0.0;
@@ -568,57 +2118,106 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 	this->generateLayout(corb);
 	cur_cost = this->evaluateLayout(corb.getAlignments()).total_cost;
 
-	// perform some random operations, for SA temperature = 0.0
-	// i.e., consider only solutions w/ improved cost
-	// track acceptance ratio and cost (phase one, area and AR mismatch)
-	// also trigger cost function to assume no fitting layouts
-	i = 1;
-	accepted_ops = 0;
-	cost_samples.reserve(SA_SAMPLING_LOOP_FACTOR * this->blocks.size());
+	// samples count; for the reduced-sample estimator, limited to the count which
+	// is sufficient for the requested confidence interval of the std dev of cost;
+	// the relative half-width of this interval is approx z / sqrt(2 (n - 1)) for n
+	// samples
+	samples = SA_SAMPLING_LOOP_FACTOR * static_cast<int>(this->blocks.size());
+	if (this->schedule.sampling_confidence > 0.0) {
+		samples = std::min(samples, 1 + static_cast<int>(std::ceil(0.5 * std::pow(FloorPlanner::SA_SAMPLING_CONFIDENCE_Z / this->schedule.sampling_confidence, 2.0))));
+	}
+	samples = std::max(samples, 2);
 
-	while (i <= SA_SAMPLING_LOOP_FACTOR * static_cast<int>(this->blocks.size())) {
+	cost_samples.reserve(samples);
 
-		// trigger random op; assume some fitting layout was found previously such
-		// that not only blocks exceeding the outline are adapted but rather
-		// random operations are performed
-		op_success = layoutOp.performLayoutOp(corb, 1);
+	// independent random walks, performed in parallel on replicas; all walks start
+	// from the initial layout
+	if (this->schedule.sampling_walks > 0) {
 
-		if (op_success) {
+		this->speculation.size = this->schedule.sampling_walks;
+		this->speculation.sampling = true;
+		this->speculation.sampling_steps = std::ceil(static_cast<double>(samples) / this->schedule.sampling_walks);
+		this->speculation.corb = &corb;
 
-			prev_cost = cur_cost;
+		// the seeds for the walks are drawn by the main thread, such that the
+		// sampling is reproducible for a fixed seed
+		for (unsigned walk = 0; walk < this->schedule.sampling_walks; walk++) {
+			this->speculation.candidates[walk].seed = Math::randEngine()();
+		}
 
-			// generate layout
-			this->generateLayout(corb);
-			// evaluate layout, new cost
-			cur_cost = this->evaluateLayout(corb.getAlignments()).total_cost;
-			// cost difference
-			cost_diff = cur_cost - prev_cost;
+		this->runWorkers();
 
-			// solution w/ worse cost, revert
-			if (cost_diff > 0.0) {
-				// revert last op
-				layoutOp.performLayoutOp(corb, 1, false, true);
-				// reset cost according to reverted CBL
-				cur_cost = prev_cost;
-			}
-			// accept solution w/ improved cost
-			else {
-				// update ops count
-				accepted_ops++;
-			}
-			// store cost
-			cost_samples.push_back(cur_cost);
+		// merge samples, in order of walks
+		for (unsigned walk = 0; walk < this->schedule.sampling_walks; walk++) {
+			std::vector<double> const& walk_samples = this->speculation.candidates[walk].cost_samples;
 
-			i++;
+			cost_samples.insert(cost_samples.end(), walk_samples.begin(), walk_samples.end());
+		}
+	}
+	// one sequential random walk
+	else {
+		// perform some random operations, for SA temperature = 0.0
+		// i.e., consider only solutions w/ improved cost
+		// track acceptance ratio and cost (phase one, area and AR mismatch)
+		// also trigger cost function to assume no fitting layouts
+		i = 1;
+		accepted_ops = 0;
+
+		while (i <= samples) {
+
+			// trigger random op; assume some fitting layout was found previously such
+			// that not only blocks exceeding the outline are adapted but rather
+			// random operations are performed
+			op_success = layoutOp.performLayoutOp(corb, 1);
+
+			if (op_success) {
+
+				prev_cost = cur_cost;
+
+				// generate layout
+				this->generateLayout(corb);
+				// evaluate layout, new cost
+				cur_cost = this->evaluateLayout(corb.getAlignments()).total_cost;
+				// cost difference
+				cost_diff = cur_cost - prev_cost;
+
+				// solution w/ worse cost, revert
+				if (cost_diff > 0.0) {
+					// revert last op
+					layoutOp.performLayoutOp(corb, 1, false, true);
+					// reset cost according to reverted CBL
+					cur_cost = prev_cost;
+				}
+				// accept solution w/ improved cost
+				else {
+					// update ops count
+					accepted_ops++;
+				}
+				// store cost
+				cost_samples.push_back(cur_cost);
+
+				i++;
+			}
 		}
 	}
 
 	// init SA parameter: start temp, depends on std dev of costs [Huan86, see
 	// Shahookar91]
-	init_temp = Math::stdDev(cost_samples) * this->schedule.temp_init_factor;
+	std_dev = Math::stdDev(cost_samples);
+	init_temp = std_dev * this->schedule.temp_init_factor;
 
 	if (this->logMed()) {
-		std::cout << "SA> Done; std dev of cost: " << Math::stdDev(cost_samples) << ", initial temperature: " << init_temp << std::endl;
+		std::cout << "SA> Done; std dev of cost: " << std_dev << ", initial temperature: " << init_temp << std::endl;
+
+		// confidence interval for std dev; note that samples of random walks
+		// are correlated, the interval is thus rather optimistic
+		if (this->schedule.sampling_confidence > 0.0) {
+			confidence = FloorPlanner::SA_SAMPLING_CONFIDENCE_Z / std::sqrt(2.0 * (cost_samples.size() - 1));
+
+			std::cout << "SA>  Reduced-sample estimator; samples: " << cost_samples.size();
+			std::cout << ", 95% confidence interval for std dev of cost: [" << std_dev * (1.0 - confidence) << ", " << std_dev * (1.0 + confidence) << "]" << std::endl;
+		}
+
 		std::cout << "SA> " << std::endl;
 		std::cout << "SA> Perform simulated annealing process..." << std::endl;
 		std::cout << "SA> Phase I: packing blocks into outline..." << std::endl;
@@ -630,7 +2229,6 @@ void FloorPlanner::initSA(CorblivarCore& corb, std::vector<double>& cost_samples
 }
 
 void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost, bool const& handle_corblivar) {
-	struct timeb end;
 	std::stringstream runtime;
 	bool valid_solution;
 	Cost cost;
@@ -854,6 +2452,11 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 	// generate floorplan plots
 	IO::writeFloorplanGP(*this, corb.getAlignments());
 
+	// generate Pareto archive, if configured for
+	if (handle_corblivar && this->schedule.pareto_archive > 0) {
+		IO::writeParetoArchive(*this);
+	}
+
 	// generate Corblivar data if solution file is used as output
 	if (handle_corblivar && this->IO_conf.solution_out.is_open()) {
 		this->IO_conf.solution_out << corb.CBLsString() << std::endl;
@@ -874,13 +2477,18 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 	}
 
 	// determine overall runtime
-	ftime(&end);
+	this->SA_stats.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - this->time_start).count();
 	if (this->logMin()) {
-		runtime << "Runtime: " << (1000.0 * (end.time - this->time_start.time) + (end.millitm - this->time_start.millitm)) / 1000.0 << " s";
+		runtime << "Runtime: " << this->SA_stats.runtime << " s";
 		std::cout << "Corblivar> " << runtime.str() << std::endl;
 		this->IO_conf.results << runtime.str() << std::endl;
 	}
 
+	// generate machine-readable report
+	this->SA_stats.valid_solution = (!handle_corblivar || valid_solution);
+	this->SA_stats.cost = cost;
+	IO::writeReport(*this, determ_overall_cost);
+
 	// close IO_conf.results file
 	this->IO_conf.results.close();
 
@@ -892,6 +2500,9 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_alignment) {
 	bool ret;
 
+	// previous extents are outdated
+	this->dies_extents.valid = false;
+
 	// generate layout
 	ret = corb.generateLayout(perform_alignment);
 
@@ -930,13 +2541,18 @@ bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_align
 		}
 	}
 
+	// determine extents of placed blocks once for the new layout
+	this->determDiesExtents();
+
 	return ret;
 }
 
 /// adaptive cost model w/ two phases: first phase considers only cost for packing into
 /// outline, second phase considers further factors like WL, thermal distr, etc.
 FloorPlanner::Cost FloorPlanner::evaluateLayout(std::vector<CorblivarAlignmentReq> const& alignments, double const& fitting_layouts_ratio, bool const& SA_phase_two, bool const& set_max_cost, bool const& finalize) {
-	Cost cost;
+	// value-initialized, i.e., all terms are zero; not all terms are determined
+	// below, e.g., voltage-assignment terms for timing-only optimization
+	Cost cost = Cost();
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		std::cout << "-> FloorPlanner::evaluateLayout(" << &alignments << ", " << fitting_layouts_ratio << ", " << SA_phase_two << ", " << set_max_cost << ", " << finalize << ")" << std::endl;
@@ -1462,23 +3078,19 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 
 	layout_fits_in_fixed_outline = true;
 	max_outline_all = 0.0;
+	// extents of blocks on all dies; only to be determined for layouts not
+	// generated via generateLayout
+	if (!this->dies_extents.valid) {
+		this->determDiesExtents();
+	}
+
 	// determine outline and area
 	for (i = 0; i < this->IC.layers; i++) {
 
-		// determine outline for blocks on all dies separately
-		max_outline_x = max_outline_y = 0.0;
-		blocks_area = 0.0;
-		for (Block const& block : this->blocks) {
-
-			if (block.layer == i) {
-
-				blocks_area += block.bb.area;
-
-				// update max outline coords
-				max_outline_x = std::max(max_outline_x, block.bb.ur.x);
-				max_outline_y = std::max(max_outline_y, block.bb.ur.y);
-			}
-		}
+		// outline and area for blocks on all dies separately
+		max_outline_x = this->dies_extents.outline[i].x;
+		max_outline_y = this->dies_extents.outline[i].y;
+		blocks_area = this->dies_extents.blocks_area[i];
 
 		// area
 		dies_area.push_back(blocks_area);
@@ -1583,6 +3195,7 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 
 	// reset TSVs
 	this->TSVs.clear();
+	this->TSVs_index.reset(this->getOutline());
 	this->dummy_TSVs.clear();
 
 	// reset wires
@@ -1807,8 +3420,9 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 
 						// define new trivial island, with one TSV
 						this->TSVs.emplace_back(TSV_Island(
-								// net id and layer
-								std::string("net_" + cur_net.id + "_" + std::to_string(i)),
+								// net island, w/ index of net as id
+								TSV_Island::Type::NET,
+								&cur_net - &this->nets.front(),
 								// one TSV count
 								1,
 								// TSV pitch; required for proper scaling
@@ -1831,7 +3445,7 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 						// errors for connecting to TSVs
 						//
 						if (finalize) {
-							TSV_Island::greedyShifting(this->TSVs.back(), this->TSVs);
+							TSV_Island::greedyShifting(this->TSVs.back(), this->TSVs, this->TSVs_index);
 						}
 					}
 				}
@@ -1873,7 +3487,7 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 	if (this->layoutOp.parameters.signal_TSV_clustering && !this->layoutOp.parameters.trivial_HPWL) {
 
 		// actual clustering
-		this->clustering.clusterSignalTSVs(this->nets, nets_segments, this->TSVs, this->techParameters.TSV_pitch, this->techParameters.TSV_per_cluster_limit, this->thermal_analysis);
+		this->clustering.clusterSignalTSVs(this->nets, nets_segments, this->TSVs, this->TSVs_index, this->techParameters.TSV_pitch, this->techParameters.TSV_per_cluster_limit, this->thermal_analysis);
 
 		// after clustering, we can obtain a more accurate wirelength and
 		// routing-utilization estimation by considering TSVs' positions as well
@@ -1994,11 +3608,10 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, double const&
 
 						// define new dummy TSV (trivial TSV island)
 						this->dummy_TSVs.emplace_back(TSV_Island(
-								// 
-								std::string("dummy_manuf_frame_"
-									+ std::to_string(x) + "_"
-									+ std::to_string(y) + "_"
-									+ std::to_string(i)),
+								// dummy island, w/ index of frame
+								// as id
+								TSV_Island::Type::DUMMY,
+								this->dummy_TSVs.size(),
 								// one TSV count
 								1,
 								// TSV pitch; required for proper scaling
@@ -2080,6 +3693,7 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 	Rect intersect, bb, routing_bb;
 	int prev_TSVs;
 	int layer, min_layer, max_layer;
+	double island_width;
 	CorblivarAlignmentReq::Evaluate eval;
 	RoutingUtilization::UtilResult util;
 
@@ -2145,16 +3759,22 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 			// not overlapping; both cases require TSVs
 			if (intersect.area != 0.0) {
 
-				// derive TSVs in all affected layers
-				min_layer = std::min(req.s_i->layer, req.s_j->layer);
-				max_layer = std::max(req.s_i->layer, req.s_j->layer);
-
-				for (layer = min_layer; layer < max_layer; layer++) {
-
-					// define new island
-					this->TSVs.emplace_back(TSV_Island(
-							// bus id
-							std::string("bus_" + req.s_i->id + "_" + req.s_j->id),
+				// for vertical buses, provide specific width according to
+				// alignment requirement
+				island_width = req.vertical_bus() ? req.alignment_x : -1.0;
+
+				// the island's outline depends only on the intersection
+				// and the width; thus, reuse the previous island's
+				// outline if possible
+				if (!req.cache.island_valid || !Rect::identical(req.cache.intersect, intersect) || req.cache.island_width != island_width) {
+
+					req.cache.island_valid = true;
+					req.cache.intersect = intersect;
+					req.cache.island_width = island_width;
+					req.cache.island_bb = TSV_Island(
+							// bus island, w/ id of request
+							TSV_Island::Type::BUS,
+							req.id,
 							// signal / TSV count
 							req.signals,
 							// TSV pitch; required for proper scaling
@@ -2164,19 +3784,33 @@ void FloorPlanner::evaluateAlignments(Cost& cost, std::vector<CorblivarAlignment
 							// point for placement of vertical
 							// bus / TSV island
 							intersect,
-							// layer assignment
-							layer,
-							// for vertical buses, provide
-							// specific width according to
-							// alignment requirement
-							req.vertical_bus() ? req.alignment_x : -1.0
+							// layer assignment; not relevant
+							// here
+							-1,
+							island_width
+						).bb;
+				}
+
+				// derive TSVs in all affected layers
+				min_layer = std::min(req.s_i->layer, req.s_j->layer);
+				max_layer = std::max(req.s_i->layer, req.s_j->layer);
+
+				for (layer = min_layer; layer < max_layer; layer++) {
+
+					// define new island, w/ outline from above
+					this->TSVs.emplace_back(TSV_Island(
+							TSV_Island::Type::BUS,
+							req.id,
+							req.signals,
+							req.cache.island_bb,
+							layer
 						));
 					TSV_Island& island = this->TSVs.back();
 
 					// perform greedy shifting in case new island
 					// overlaps with any previous one
 					//
-					TSV_Island::greedyShifting(island, this->TSVs);
+					TSV_Island::greedyShifting(island, this->TSVs, this->TSVs_index);
 
 					// determine the HPWL components and routing
 					// utilization; net segments are to be considered
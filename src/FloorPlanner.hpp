@@ -36,6 +36,7 @@
 class Block;
 class CorblivarCore;
 class CorblivarAlignmentReq;
+enum class Direction : unsigned;
 
 /// Corblivar floorplanner (SA operations and related handler)
 class FloorPlanner {
@@ -60,6 +61,8 @@ class FloorPlanner {
 
 		/// groups of TSVs, will be defined from nets and vertical buses
 		std::vector<TSV_Island> TSVs;
+		/// spatial index of TSV islands, for greedy shifting
+		TSV_Island::Index TSVs_index;
 		/// groups of dummy filler TSVs, required for minimum TSV density
 		std::vector<TSV_Island> dummy_TSVs;
 
@@ -70,6 +73,23 @@ class FloorPlanner {
 		/// dummy reference block, represents lower-left corner of dies
 		RBOD const RBOD;
 
+		/// POD for extents of placed blocks on each die, i.e., outline and
+		/// blocks area; determined once per layout generation, see
+		/// generateLayout, and considered for area and outline cost
+		mutable struct dies_extents {
+
+			/// outer vector: dies; outline covered by blocks
+			std::vector<Point> outline;
+			/// outer vector: dies; area of blocks
+			std::vector<double> blocks_area;
+
+			/// flag whether extents relate to current layout; not the case
+			/// for layouts not generated via generateLayout, e.g., parsed
+			/// layouts
+			bool valid = false;
+
+		} dies_extents;
+
 		/// POD for 3D IC parameters
 		struct IC {
 
@@ -142,6 +162,19 @@ class FloorPlanner {
 			bool alignments_file_avail;
 			/// flag whether benchmark is in GATech syntax/format or not
 			bool GT_benchmark;
+			/// SA telemetry; periodic progress records, written as JSON lines
+			std::ofstream telemetry;
+			/// SA telemetry; interval [s] between progress records
+			double telemetry_interval;
+			/// SA checkpoints; file to be written periodically, empty for none
+			std::string checkpoint_file;
+			/// SA checkpoints; interval [s] between checkpoints
+			double checkpoint_interval;
+			/// SA checkpoints; checkpoint to resume SA from
+			std::ifstream checkpoint_in;
+			/// directory for all output files, w/ trailing slash; empty for the
+			/// current working directory
+			std::string output_dir;
 		} IO_conf;
 
 		/// benchmark name
@@ -152,7 +185,7 @@ class FloorPlanner {
 		bool thermal_analyser_run;
 
 		/// time logging
-		struct timeb time_start;
+		std::chrono::steady_clock::time_point time_start;
 
 		/// logging
 		int log;
@@ -173,6 +206,45 @@ class FloorPlanner {
 
 			/// SA parameters: temperature-scaling factors
 			double temp_factor_phase1, temp_factor_phase1_limit, temp_factor_phase2, temp_factor_phase3;
+
+			/// SA parameters: run control; parsed from optional command-line
+			/// parameters in IO::parseParametersFiles
+			bool fixed_seed;
+			/// SA parameters: run control; seed for random-number generator
+			unsigned seed;
+			/// SA parameters: run control; wall-clock budget [s] for SA, 0.0
+			/// for none; the schedule is adapted to complete within the budget,
+			/// see FloorPlanner::adaptScheduleTimeBudget
+			double time_budget;
+			/// SA parameters: run control; convergence-based termination
+			/// after given steps w/o improvement, 0 for none
+			int stop_steps;
+			/// SA parameters: run control; inner-loop length adapted to
+			/// acceptance ratio
+			bool adaptive_inner_loop;
+			/// SA parameters: run control; count of candidate moves to be
+			/// evaluated speculatively in parallel, 0 for sequential moves;
+			/// see FloorPlanner::evaluateCandidateMoves
+			unsigned speculative_moves;
+			/// SA parameters: run control; count of independent random walks
+			/// for solution-space sampling, evaluated in parallel, 0 for
+			/// sequential sampling; see FloorPlanner::initSA
+			unsigned sampling_walks;
+			/// SA parameters: run control; reduced-sample estimator for
+			/// solution-space sampling; max relative half-width of the 95%
+			/// confidence interval of the std dev of cost, 0.0 for none
+			double sampling_confidence;
+			/// SA parameters: run control; count of coarsening levels for
+			/// multilevel floorplanning, 0 for flat SA; see
+			/// FloorPlanner::performMultilevelSA
+			unsigned multilevel;
+			/// SA parameters: run control; warm start, i.e., refinement of the
+			/// solution file given via ``--warm-start''; see
+			/// FloorPlanner::performRefinementSA
+			bool warm_start;
+			/// SA parameters: run control; max count of solutions in the Pareto
+			/// archive, 0 for none; see FloorPlanner::updateParetoArchive
+			unsigned pareto_archive;
 		} schedule;
 
 		/// SA parameters: optimization flags
@@ -278,6 +350,9 @@ class FloorPlanner {
 
 		/// SA parameter: scaling factor for loops during solution-space sampling
 		static constexpr int SA_SAMPLING_LOOP_FACTOR = 1;
+		/// SA parameter: reduced-sample estimator for solution-space sampling;
+		/// z-value for the 95% confidence interval of the std dev of cost
+		static constexpr double SA_SAMPLING_CONFIDENCE_Z = 1.96;
 
 		/// SA-related temperature step; POD declaration
 		struct TempStep {
@@ -286,6 +361,8 @@ class FloorPlanner {
 			double avg_cost;
 			bool new_best_sol_found;
 			double cost_best_sol;
+			int inner_loop_max;
+			double accepted_ops_ratio;
 		};
 
 		/// SA-related temperature phase; POD declaration
@@ -299,6 +376,251 @@ class FloorPlanner {
 		/// SA: reheating parameters, for SA phase 3
 		static constexpr double SA_REHEAT_STD_DEV_COST_LIMIT = 1.0e-4;
 
+		/// SA: time-budgeted schedule; range for the adapted inner-loop length,
+		/// relative to the regular length
+		static constexpr double SA_BUDGET_INNER_LOOP_MIN = 0.1;
+		/// SA: time-budgeted schedule; range for the adapted inner-loop length,
+		/// relative to the regular length
+		static constexpr double SA_BUDGET_INNER_LOOP_MAX = 10.0;
+		/// SA: time-budgeted schedule; share of the budget the cooling schedule
+		/// is planned for, the remainder covers fluctuations of the throughput
+		static constexpr double SA_BUDGET_SHARE = 0.9;
+
+		/// SA: convergence-based termination; acceptance ratio below which the
+		/// chain is considered as frozen
+		static constexpr double SA_CONVERGENCE_ACCEPT_RATIO = 0.25;
+		/// SA: convergence-based termination; std dev of avg cost below which
+		/// the chain is considered as converged
+		static constexpr double SA_CONVERGENCE_STD_DEV_COST_LIMIT = 1.0e-4;
+
+		/// SA: adaptive inner-loop length; acceptance ratios below the lower /
+		/// above the upper limit result in shorter inner loops
+		static constexpr double SA_ADAPTIVE_LOOP_ACCEPT_LOW = 0.05;
+		/// SA: adaptive inner-loop length; acceptance ratios below the lower /
+		/// above the upper limit result in shorter inner loops
+		static constexpr double SA_ADAPTIVE_LOOP_ACCEPT_HIGH = 0.5;
+		/// SA: adaptive inner-loop length; min length, relative to the regular
+		/// length
+		static constexpr double SA_ADAPTIVE_LOOP_MIN = 0.25;
+
+		/// SA: multilevel floorplanning; min count of blocks for a further
+		/// coarsening level
+		static constexpr unsigned ML_BLOCKS_MIN = 20;
+		/// SA: multilevel floorplanning; min reduction of blocks count for a
+		/// further coarsening level, i.e., max ratio of clusters to blocks
+		static constexpr double ML_CLUSTERS_RATIO_MAX = 0.9;
+		/// SA: multilevel floorplanning; nets w/ more blocks are ignored for
+		/// coarsening, they hardly indicate affinity of particular blocks
+		static constexpr unsigned ML_NET_DEGREE_MAX = 16;
+		/// SA: multilevel floorplanning; AR range for clusters of multiple
+		/// soft blocks, which are handled as soft blocks on the coarse level
+		static constexpr double ML_CLUSTER_AR_MIN = 0.5;
+		/// SA: multilevel floorplanning; AR range for clusters of multiple
+		/// soft blocks, which are handled as soft blocks on the coarse level
+		static constexpr double ML_CLUSTER_AR_MAX = 2.0;
+		/// SA: refinement, i.e., after uncoarsening for multilevel
+		/// floorplanning or for warm starts; start temperature relative to the
+		/// regular schedule
+		static constexpr double SA_REFINE_TEMP_SCALE = 0.1;
+		/// SA: refinement, i.e., after uncoarsening for multilevel
+		/// floorplanning or for warm starts; outer-loop limit relative to the
+		/// regular schedule; for multilevel floorplanning, also the share of
+		/// the time budget
+		static constexpr double SA_REFINE_LOOP_SCALE = 0.25;
+
+		/// SA: multilevel floorplanning; coarsening helper, sets up the
+		/// next-coarser level; the coarse blocks relate to the clusters of this
+		/// level's blocks by index; returns false if no further coarsening is
+		/// reasonable
+		bool coarsen(FloorPlanner& coarse, std::vector< std::vector<Block const*> >& clusters) const;
+		/// SA: multilevel floorplanning; uncoarsening helper, derives the CBLs of
+		/// this level from the coarse CBLs and re-packs the clusters' blocks w/in
+		/// the clusters' bounding boxes
+		void uncoarsen(CorblivarCore& corb, CorblivarCore const& corb_coarse, FloorPlanner const& coarse,
+				std::vector< std::vector<Block const*> > const& clusters) const;
+
+		/// SA: Pareto archive; count of criteria, i.e., actual values of cost
+		/// terms, see FloorPlanner::paretoCriteria
+		static constexpr unsigned PARETO_CRITERIA = 8;
+
+		/// SA: Pareto archive; compact snapshot of a CBL tuple, w/ the block's
+		/// shape; the block is referenced by its index
+		struct ParetoTuple {
+			unsigned block;
+			Direction L;
+			unsigned T;
+			double w, h;
+		};
+		/// SA: Pareto archive; non-dominated fitting solution
+		struct ParetoSolution {
+			/// actual values of the criteria; all to be minimized
+			std::array<double, PARETO_CRITERIA> criteria;
+			/// CBLs of all dies
+			std::vector< std::vector<ParetoTuple> > CBLs;
+			/// SA step where the solution was found
+			int step;
+		};
+		/// SA: Pareto archive of non-dominated solutions fitting into the
+		/// outline, bounded by schedule.pareto_archive
+		std::vector<ParetoSolution> paretoArchive;
+
+		/// SA: Pareto archive; helper, returns criteria of given cost
+		std::array<double, PARETO_CRITERIA> paretoCriteria(Cost const& cost) const;
+		/// SA: Pareto archive; handler, considers the current solution for the
+		/// archive; returns true if the solution was archived
+		bool updateParetoArchive(CorblivarCore const& corb, Cost const& cost, int const& step);
+
+		/// SA statistics and final results; required for machine-readable report,
+		/// see IO::writeReport
+		struct SA_stats {
+			/// evaluated layout operations
+			unsigned long moves;
+			/// runtime [s] of SA and overall runtime [s]
+			double SA_runtime, runtime;
+			/// convergence-based termination triggered
+			bool converged;
+			/// final solution
+			bool valid_solution;
+			/// final solution
+			Cost cost;
+		} SA_stats;
+
+		/// SA checkpoint; state of the main SA loop at the beginning of a
+		/// temperature step, i.e., all data which is not captured in the
+		/// FloorPlanner and CorblivarCore instances themselves; see
+		/// IO::writeCheckpoint for the complete set of checkpointed data
+		struct SA_checkpoint {
+			/// loop control
+			int step, loop_limit, innerLoopMax, innerLoopMax_regular;
+			/// temperature and phases
+			double temp;
+			/// temperature and phases
+			TempPhase cooling_phase;
+			/// temperature and phases
+			bool SA_phase_two;
+			/// fitting layouts and best solution
+			double fitting_layouts_ratio;
+			/// fitting layouts and best solution
+			bool valid_layout_found;
+			/// fitting layouts and best solution
+			int step_valid_layout_found;
+			/// fitting layouts and best solution
+			double best_cost;
+			/// fitting layouts and best solution; only the normalized terms
+			/// required for SA telemetry are checkpointed
+			Cost best_cost_terms;
+			/// throughput and elapsed time [s] of SA; note that time-budgeted
+			/// runs are thus not reproduced bit-exactly
+			double moves_per_s, elapsed;
+		} SA_checkpoint;
+
+		/// SA speculative moves; one candidate move, evaluated on a replica of
+		/// this floorplanner and its Corblivar core by a dedicated worker
+		/// thread; also used for parallel solution-space sampling, then
+		/// representing one random walk
+		struct SpeculativeCandidate {
+			/// replica; synchronized w/ this instance before each evaluation
+			std::unique_ptr<FloorPlanner> fp;
+			/// replica; synchronized w/ this instance before each evaluation
+			std::unique_ptr<CorblivarCore> corb;
+			/// seed for the worker's random-number generator; drawn by the
+			/// main thread, such that the SA run remains reproducible
+			unsigned seed;
+			/// outcome of evaluation
+			bool op_success, accept;
+			/// outcome of evaluation
+			int op;
+			/// outcome of evaluation
+			double cost_diff, runtime;
+			/// outcome of solution-space sampling
+			std::vector<double> cost_samples;
+		};
+
+		/// SA speculative moves; candidates and worker threads, along w/ the
+		/// parameters of the current batch and the synchronization
+		struct speculation {
+			/// candidates, one for each worker thread
+			std::vector<SpeculativeCandidate> candidates;
+			/// worker threads
+			std::vector<std::thread> workers;
+			/// synchronization
+			std::mutex mutex;
+			/// synchronization
+			std::condition_variable batch_start, batch_done;
+			/// synchronization; id of current batch
+			unsigned long batch;
+			/// synchronization; count of evaluated candidates
+			unsigned done;
+			/// synchronization; flag to terminate workers
+			bool stop;
+			/// parameters of current batch; count of involved candidates
+			unsigned size;
+			/// parameters of current batch; solution-space sampling or
+			/// evaluation of candidate moves
+			bool sampling;
+			/// parameters of current batch; steps of each random walk
+			int sampling_steps;
+			/// parameters of current batch
+			CorblivarCore const* corb;
+			/// parameters of current batch
+			double cur_cost, temp, fitting_layouts_ratio;
+			/// parameters of current batch
+			int layout_fit_counter;
+			/// parameters of current batch
+			bool cooling_phase_three;
+			/// candidates which were evaluated but discarded, since an
+			/// earlier candidate of the same batch was accepted
+			unsigned long discarded;
+			/// committed candidates which were not reproduced as evaluated by
+			/// the replica, i.e., w/ a different op or cost; handled as
+			/// regular ops
+			unsigned long mismatched;
+		} speculation;
+
+		/// replicate the configuration of the given floorplanner, as parsed in
+		/// IO::parseParametersFiles; covers the parameters and the input files,
+		/// not the benchmark data itself
+		void replicateConfig(FloorPlanner const& setup);
+		/// replicate the benchmark of the given floorplanner, i.e., blocks,
+		/// terminal pins, nets, and alignment requests; the pointers are
+		/// re-linked to the data of this floorplanner
+		void replicateBenchmark(FloorPlanner const& setup, std::vector<CorblivarAlignmentReq> const& alignments_setup,
+				std::vector<CorblivarAlignmentReq>& alignments);
+
+		/// SA speculative moves and parallel sampling; setup replicas and worker
+		/// threads
+		void initWorkers(CorblivarCore const& corb, unsigned const& count);
+		/// SA speculative moves and parallel sampling; terminate worker threads,
+		/// release replicas
+		void stopWorkers();
+		/// SA speculative moves and parallel sampling; trigger workers for
+		/// current batch, wait for all of them
+		void runWorkers();
+		/// SA speculative moves; evaluate batch of candidate moves in parallel,
+		/// all derived from the current layout; the outcomes are memorized in
+		/// the candidates
+		void evaluateCandidateMoves(CorblivarCore const& corb, double const& cur_cost, double const& temp, double const& fitting_layouts_ratio,
+				int const& layout_fit_counter, bool const& cooling_phase_three);
+		/// SA speculative moves; update the statistics of layout operations for
+		/// the rejected candidates ahead of the given index
+		void updateSpeculativeOpStats(bool const& SA_phase_two, double const& cur_cost, unsigned const& candidates);
+		/// SA speculative moves and parallel sampling; worker-thread handler
+		void workerHandler(unsigned const& candidate);
+		/// SA speculative moves; evaluate one candidate move, on the candidate's
+		/// replica
+		void evaluateCandidateMove(SpeculativeCandidate& candidate) const;
+		/// SA parallel sampling; perform one random walk, on the candidate's
+		/// replica
+		void sampleSolutionSpace(SpeculativeCandidate& candidate) const;
+		/// SA speculative moves and parallel sampling; synchronize replica w/ the current state of this
+		/// instance and the given Corblivar core
+		void syncReplica(FloorPlanner& fp, CorblivarCore& corb, CorblivarCore const& corb_master) const;
+
+		/// SA telemetry; write progress record, i.e., one JSON line
+		void writeTelemetry(double const& time, int const& step, double const& temp, TempPhase const& cooling_phase, bool const& SA_phase_two,
+				double const& moves_per_s, double const& accepted_ops_ratio, double const& fitting_layouts_ratio,
+				Cost const& cost, Cost const* best_cost);
+
 		/// layout-generation helper
 		bool generateLayout(CorblivarCore& corb, bool const& perform_alignment = false);
 
@@ -325,7 +647,20 @@ class FloorPlanner {
 		void initSA(CorblivarCore& corb, std::vector<double>& cost_samples, int& innerLoopMax, double& init_temp);
 		/// SA: helper for annealing schedule
 		/// note that various parameters are return-by-reference
-		TempPhase updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const;
+		TempPhase updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout, int const& loop_limit) const;
+		/// SA: helper for time-budgeted annealing schedule; adapts inner-loop
+		/// length and outer-loop limit to the remaining time and the measured
+		/// throughput
+		/// note that various parameters are return-by-reference
+		void adaptScheduleTimeBudget(double const& elapsed, double const& moves_per_s, int const& iteration, int const& innerLoopMax_regular,
+				int& innerLoopMax, int& loop_limit) const;
+		/// SA: helper for time-budgeted annealing schedule; checks whether the
+		/// time budget, if any, is reached
+		bool checkTimeBudget(std::chrono::steady_clock::time_point const& SA_start) const;
+		/// SA: helper for adaptive inner-loop length
+		int adaptInnerLoop(int const& innerLoopMax, double const& accepted_ops_ratio) const;
+		/// SA: helper for convergence-based termination
+		bool checkConvergence(int const& iteration, int const& iteration_first_valid_layout) const;
 
 		/// thermal analyzer instance
 		ThermalAnalyzer thermalAnalyzer;
@@ -363,15 +698,36 @@ class FloorPlanner {
 		/// default constructor
 		FloorPlanner() {
 			// memorize start time
-			ftime(&(this->time_start));
+			this->time_start = std::chrono::steady_clock::now();
 
 			// init random number generator
-			srand(time(0));
+			Math::seed(time(0));
+
+			// init SA statistics
+			this->SA_stats.moves = 0;
+			this->SA_stats.SA_runtime = this->SA_stats.runtime = 0.0;
+			this->SA_stats.valid_solution = this->SA_stats.converged = false;
+
+			// init speculative moves
+			this->speculation.batch = this->speculation.discarded = this->speculation.mismatched = 0;
+			this->speculation.done = 0;
+			this->speculation.stop = false;
 		}
 
+		/// destructor; terminates worker threads, if any
+		~FloorPlanner();
+
 	// public data, functions
 	public:
 		friend class IO;
+		/// micro-benchmarks, see src_aux/Benchmark.cpp
+		friend class Benchmark;
+		/// batch job driver, see src_aux/Batch.cpp
+		friend class Batch;
+		/// embeddable API, see src/CorblivarAPI.hpp
+		friend class CorblivarAPI;
+		/// evaluation server, see src_aux/Server.cpp
+		friend class Server;
 
 		/// logging
 		inline bool logMin() const {
@@ -493,10 +849,7 @@ class FloorPlanner {
 
 			// determine blocks outline across; reasonable common die outline
 			// for whole 3D-IC stack
-			for (Block const& b : this->blocks) {
-				outline.x = std::max(outline.x, b.bb.ur.x);
-				outline.y = std::max(outline.y, b.bb.ur.y);
-			}
+			outline = this->determBlocksOutline();
 
 			// now, shrink fixed outline if any dimension is smaller than
 			// previous outline
@@ -509,11 +862,13 @@ class FloorPlanner {
 				this->IC.outline_x = outline.x;
 				this->IC.outline_y = outline.y;
 
-				// also reset the power maps setting
-				this->thermalAnalyzer.initPowerMaps(this->IC.layers, this->getOutline());
+				// also re-target the power maps to the new outline; the maps'
+				// storage is kept
+				this->thermalAnalyzer.scalePowerMaps(this->getOutline());
 
-				// and the routing-estimation maps have to be reset as well
-				this->routingUtil.initUtilMaps(this->IC.layers, this->getOutline());
+				// and the routing-estimation maps have to be re-targeted as
+				// well
+				this->routingUtil.scaleUtilMaps(this->getOutline());
 
 				// reset related die properties
 				this->IC.die_AR = this->IC.outline_x / this->IC.outline_y;
@@ -528,6 +883,45 @@ class FloorPlanner {
 			return outline;
 		}
 
+		/// helper for die geometry; determines extents of placed blocks for all
+		/// dies in one pass, see dies_extents
+		///
+		inline void determDiesExtents() const {
+
+			this->dies_extents.outline.assign(this->IC.layers, Point(0.0, 0.0));
+			this->dies_extents.blocks_area.assign(this->IC.layers, 0.0);
+
+			for (Block const& b : this->blocks) {
+
+				if (0 <= b.layer && b.layer < this->IC.layers) {
+
+					this->dies_extents.blocks_area[b.layer] += b.bb.area;
+
+					this->dies_extents.outline[b.layer].x = std::max(this->dies_extents.outline[b.layer].x, b.bb.ur.x);
+					this->dies_extents.outline[b.layer].y = std::max(this->dies_extents.outline[b.layer].y, b.bb.ur.y);
+				}
+			}
+
+			this->dies_extents.valid = true;
+		}
+
+		/// helper for die geometry; outline covered by blocks on all dies
+		///
+		inline Point determBlocksOutline() const {
+			Point outline;
+
+			if (!this->dies_extents.valid) {
+				this->determDiesExtents();
+			}
+
+			for (Point const& die_outline : this->dies_extents.outline) {
+				outline.x = std::max(outline.x, die_outline.x);
+				outline.y = std::max(outline.y, die_outline.y);
+			}
+
+			return outline;
+		}
+
 		/// helper for die geometry
 		///
 		inline void scaleTerminalPins(Point outline) {
@@ -558,8 +952,23 @@ class FloorPlanner {
 			return this->IO_conf.solution_in.is_open();
 		};
 
+		/// getter
+		inline bool const& warmStart() const {
+			return this->schedule.warm_start;
+		};
+
+		/// Corblivar core: init handler; generates new data set, w/ blocks
+		/// assigned to dies by min-cut partitioning or randomly, and
+		/// w/ tuples optionally ordered by analytical placement
+		void initCorblivar(CorblivarCore& corb);
 		/// SA: main handler
 		bool performSA(CorblivarCore& corb);
+		/// SA: refinement handler; short, low-temperature SA starting from the
+		/// current CBLs
+		bool performRefinementSA(CorblivarCore& corb);
+		/// SA: multilevel handler; anneals coarsened levels and refines them
+		/// after uncoarsening, falls back to performSA for flat SA
+		bool performMultilevelSA(CorblivarCore& corb);
 		/// SA: finalize handler
 		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true);
 };
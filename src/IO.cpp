@@ -28,38 +28,91 @@
 #include "CorblivarCore.hpp"
 
 /// parse program parameter, config file, and further files
-void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
-	int file_version;
-	size_t last_slash;
+void IO::parseParametersFiles(FloorPlanner& fp, int const& argc_all, char** argv_all) {
+	std::vector<char*> args;
+	std::string arg;
 	std::ifstream in;
-	std::string config_file, technology_file;
+	std::string config_file;
 	std::stringstream results_file;
 	std::stringstream blocks_file;
 	std::stringstream alignments_file;
 	std::stringstream pins_file;
 	std::stringstream power_density_file;
 	std::stringstream nets_file;
-	std::string tmpstr;
-	ThermalAnalyzer::MaskParameters mask_parameters;
+	double TSV_density;
 
 	std::stringstream GT_fp_file;
 	// (TODO) handle individual pins for each block
 	//std::stringstream GT_pins_file;
 	std::stringstream GT_power_file;
 
+	// init optional parameters
+	IO::initNamedParameters(fp);
+
+	// extract optional named parameters, i.e., ``--name value'' pairs; all other
+	// parameters are considered as regular positional parameters
+	for (int i = 0; i < argc_all; i++) {
+
+		arg = argv_all[i];
+
+		if (arg.size() > 2 && arg.compare(0, 2, "--") == 0) {
+
+			if (i + 1 == argc_all) {
+				std::cout << "IO> Value missing for optional parameter ``" << arg << "''" << std::endl;
+				exit(1);
+			}
+
+			IO::parseNamedParameter(fp, arg, argv_all[i + 1]);
+
+			// skip value
+			i++;
+		}
+		else {
+			args.push_back(argv_all[i]);
+		}
+	}
+
+	// positional parameters
+	int const argc = args.size();
+	char** argv = args.data();
+
 	// print command-line parameters
 	if (argc < 4) {
-		std::cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density]" << std::endl;
+		std::cout << "IO> Usage: " << argv_all[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density] [--name value ...]" << std::endl;
 		std::cout << "IO> " << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmark_name'': any name, should be same as benchmark's files names" << std::endl;
 		std::cout << "IO> Mandatory parameter ``config_file'' format: see provided Corblivar.conf" << std::endl;
 		std::cout << "IO> Mandatory parameter ``benchmarks_dir'': folder containing actual benchmark files" << std::endl;
 		std::cout << "IO> Optional parameter ``solution_file'': re-evaluate w/ given Corblivar solution" << std::endl;
 		std::cout << "IO> Optional parameter ``TSV density'': average TSV density to be considered across all dies, to be given in \%" << std::endl;
+		std::cout << "IO> Optional named parameter ``--seed'': fixed seed for random-number generator, for reproducible runs" << std::endl;
+		std::cout << "IO> Optional named parameter ``--time-budget'': wall-clock budget for SA, to be given in [s]; the schedule is adapted to complete within the budget" << std::endl;
+		std::cout << "IO> Optional named parameter ``--stop-steps'': terminate SA once no better solution is found for given temperature steps at low acceptance, or once the avg cost has converged" << std::endl;
+		std::cout << "IO> Optional named parameter ``--adaptive-inner-loop'': adapt inner-loop length to acceptance ratio (boolean, i.e., 0 or 1); default: 0" << std::endl;
+		std::cout << "IO> Optional named parameter ``--adaptive-op-selection'': select layout operations w.r.t. their recent relative cost improvements, separately for both SA phases (boolean, i.e., 0 or 1); default: 0" << std::endl;
+		std::cout << "IO> Optional named parameter ``--partitioning-init'': assign blocks initially to dies by min-cut partitioning of the nets, w/ balanced blocks area (boolean, i.e., 0 or 1); default: 0, i.e., random assignment" << std::endl;
+		std::cout << "IO> Optional named parameter ``--placement-init'': order CBL tuples initially and set their insertion directions by analytical placement of the blocks (boolean, i.e., 0 or 1); default: 0, i.e., random order and directions" << std::endl;
+		std::cout << "IO> Optional named parameter ``--speculative-moves'': count of candidate moves to be evaluated in parallel on worker threads during SA phase two; the first accepted candidate is committed; default: 0, i.e., sequential moves" << std::endl;
+		std::cout << "IO> Optional named parameter ``--sampling-walks'': count of independent random walks for initial solution-space sampling, to be performed in parallel on worker threads; default: 0, i.e., one sequential walk" << std::endl;
+		std::cout << "IO> Optional named parameter ``--sampling-confidence'': reduced-sample estimator for initial solution-space sampling; max relative half-width of the 95% confidence interval for the std dev of cost, e.g., 0.05; default: none, i.e., N samples for N blocks" << std::endl;
+		std::cout << "IO> Optional named parameter ``--multilevel'': count of coarsening levels for multilevel floorplanning; the coarsest level is annealed, the finer levels are refined by short, low-temperature SA runs; default: 0, i.e., flat SA" << std::endl;
+		std::cout << "IO> Optional named parameter ``--warm-start'': refine given Corblivar solution by short, low-temperature SA; blocks removed from / added to the benchmark are dropped / inserted randomly" << std::endl;
+		std::cout << "IO> Optional named parameter ``--pareto-archive'': max count of non-dominated solutions, collected during SA and written as separate solution files; default 0, i.e., no archive" << std::endl;
+		std::cout << "IO> Optional named parameter ``--telemetry'': file for periodic SA progress records (JSON lines)" << std::endl;
+		std::cout << "IO> Optional named parameter ``--telemetry-interval'': interval between progress records, to be given in [s]; default: 1.0" << std::endl;
+		std::cout << "IO> Optional named parameter ``--checkpoint'': file for periodic SA checkpoints, written at the end of temperature steps" << std::endl;
+		std::cout << "IO> Optional named parameter ``--checkpoint-interval'': interval between checkpoints, to be given in [s]; 0 for every step; default: 300" << std::endl;
+		std::cout << "IO> Optional named parameter ``--resume'': resume SA from given checkpoint; requires same benchmark, config file, and named parameters" << std::endl;
+		std::cout << "IO> Optional named parameter ``--output-dir'': directory for all output files, created if not existing; default: current working directory" << std::endl;
 
 		exit(1);
 	}
 
+	// fixed seed, overrides the time-based seed of FloorPlanner
+	if (fp.schedule.fixed_seed) {
+		Math::seed(fp.schedule.seed);
+	}
+
 	// TSV density given; note special run mode where only thermal-analysis result is
 	// output, not all other (time-consuming) date
 	if (argc == 6) {
@@ -92,8 +145,12 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	nets_file << argv[3] << fp.benchmark << ".nets";
 	fp.IO_conf.nets_file = nets_file.str();
 
-	results_file << fp.benchmark << ".results";
+	results_file << fp.IO_conf.output_dir << fp.benchmark << ".results";
 	fp.IO_conf.results.open(results_file.str().c_str());
+	if (!fp.IO_conf.results.good()) {
+		std::cout << "IO> Cannot write results file: " << results_file.str() << std::endl;
+		exit(1);
+	}
 
 	GT_fp_file << argv[3] << fp.benchmark << ".fpi";
 	fp.IO_conf.GT_fp_file = GT_fp_file.str();
@@ -105,15 +162,6 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	GT_power_file << argv[3] << fp.benchmark << ".pow";
 	fp.IO_conf.GT_power_file = GT_power_file.str();
 
-	// determine path of technology file; same as config file per definition
-	last_slash = config_file.find_last_of('/');
-	if (last_slash == std::string::npos) {
-		technology_file = "";
-	}
-	else {
-		technology_file = config_file.substr(0, last_slash) + "/";
-	}
-
 	// assume minimal log level; actual level to be parsed later on
 	fp.log = FloorPlanner::LOG_MINIMAL;
 
@@ -222,8 +270,34 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 	// additional command-line parameters
 	//
+	// warm start; solution file given as named parameter, consider file for readin;
+	// a new solution file is generated as well
+	if (fp.schedule.warm_start) {
+
+		if (argc > 4) {
+			std::cout << "IO> ";
+			std::cout << "Warm start and solution file for re-evaluation cannot be combined!" << std::endl;
+			exit(1);
+		}
+		if (fp.IO_conf.solution_file == fp.IO_conf.output_dir + fp.benchmark + ".solution") {
+			std::cout << "IO> ";
+			std::cout << "Solution file for warm start would be overwritten: " << fp.IO_conf.solution_file << "; consider renaming it!" << std::endl;
+			exit(1);
+		}
+
+		fp.IO_conf.solution_in.open(fp.IO_conf.solution_file.c_str());
+		if (!fp.IO_conf.solution_in.good())
+		{
+			std::cout << "IO> ";
+			std::cout << "No such solution file: " << fp.IO_conf.solution_file << std::endl;
+			exit(1);
+		}
+
+		fp.IO_conf.solution_file = fp.IO_conf.output_dir + fp.benchmark + ".solution";
+		fp.IO_conf.solution_out.open(fp.IO_conf.solution_file.c_str());
+	}
 	// additional parameter for solution file given; consider file for readin
-	if (argc > 4) {
+	else if (argc > 4) {
 
 		fp.IO_conf.solution_file = argv[4];
 		// open file if possible
@@ -237,19 +311,188 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	}
 	// open new solution file
 	else {
-		fp.IO_conf.solution_file = fp.benchmark + ".solution";
+		fp.IO_conf.solution_file = fp.IO_conf.output_dir + fp.benchmark + ".solution";
 		fp.IO_conf.solution_out.open(fp.IO_conf.solution_file.c_str());
 	}
 
 	// additional parameter for TSV density given, in percent
 	if (argc == 6) {
-		mask_parameters.TSV_density = atof(argv[5]);
+		TSV_density = atof(argv[5]);
 	}
 	// otherwise assume a setup w/o regularly spread TSVs, i.e., TSV density is zero
 	else {
-		mask_parameters.TSV_density = 0.0;
+		TSV_density = 0.0;
+	}
+
+	// parse config and technology files
+	IO::parseConfigFiles(fp, config_file, TSV_density);
+}
+
+/// init optional named parameters to their defaults
+void IO::initNamedParameters(FloorPlanner& fp) {
+	fp.schedule.fixed_seed = false;
+	fp.schedule.seed = 0;
+	fp.schedule.time_budget = 0.0;
+	fp.schedule.stop_steps = 0;
+	fp.schedule.adaptive_inner_loop = false;
+	fp.layoutOp.parameters.adaptive_op_selection = false;
+	fp.layoutOp.parameters.partitioning_init = false;
+	fp.layoutOp.parameters.placement_init = false;
+	fp.schedule.speculative_moves = 0;
+	fp.schedule.sampling_walks = 0;
+	fp.schedule.sampling_confidence = 0.0;
+	fp.schedule.multilevel = 0;
+	fp.schedule.warm_start = false;
+	fp.schedule.pareto_archive = 0;
+	fp.IO_conf.telemetry_interval = 1.0;
+	fp.IO_conf.checkpoint_interval = 300.0;
+	fp.IO_conf.output_dir = "";
+}
+
+/// parse one optional named parameter, i.e., a ``--name value'' pair
+void IO::parseNamedParameter(FloorPlanner& fp, std::string const& name, std::string const& value) {
+
+	if (name == "--seed") {
+		fp.schedule.fixed_seed = true;
+		fp.schedule.seed = std::stoul(value);
+	}
+	else if (name == "--time-budget") {
+		fp.schedule.time_budget = std::stod(value);
+
+		// sanity check for positive budget
+		if (fp.schedule.time_budget <= 0.0) {
+			std::cout << "IO> Provide a positive time budget!" << std::endl;
+			exit(1);
+		}
+	}
+	else if (name == "--stop-steps") {
+		fp.schedule.stop_steps = std::stoi(value);
+
+		// sanity check for positive steps
+		if (fp.schedule.stop_steps <= 0) {
+			std::cout << "IO> Provide a positive number of steps for convergence-based termination!" << std::endl;
+			exit(1);
+		}
+	}
+	else if (name == "--adaptive-inner-loop") {
+		fp.schedule.adaptive_inner_loop = std::stoi(value);
+	}
+	else if (name == "--adaptive-op-selection") {
+		fp.layoutOp.parameters.adaptive_op_selection = std::stoi(value);
+	}
+	else if (name == "--partitioning-init") {
+		fp.layoutOp.parameters.partitioning_init = std::stoi(value);
+	}
+	else if (name == "--placement-init") {
+		fp.layoutOp.parameters.placement_init = std::stoi(value);
+	}
+	else if (name == "--speculative-moves") {
+		fp.schedule.speculative_moves = std::stoul(value);
+
+		// a single candidate is equivalent to sequential moves
+		if (fp.schedule.speculative_moves == 1) {
+			fp.schedule.speculative_moves = 0;
+		}
+	}
+	else if (name == "--sampling-walks") {
+		fp.schedule.sampling_walks = std::stoul(value);
+	}
+	else if (name == "--sampling-confidence") {
+		fp.schedule.sampling_confidence = std::stod(value);
+
+		// sanity check for positive half-width
+		if (fp.schedule.sampling_confidence <= 0.0) {
+			std::cout << "IO> Provide a positive relative half-width for the confidence interval of the sampling!" << std::endl;
+			exit(1);
+		}
+	}
+	else if (name == "--multilevel") {
+		fp.schedule.multilevel = std::stoul(value);
+	}
+	else if (name == "--warm-start") {
+		fp.schedule.warm_start = true;
+		fp.IO_conf.solution_file = value;
+	}
+	else if (name == "--pareto-archive") {
+		fp.schedule.pareto_archive = std::stoul(value);
+	}
+	else if (name == "--telemetry") {
+		fp.IO_conf.telemetry.open(value);
+
+		if (!fp.IO_conf.telemetry.good()) {
+			std::cout << "IO> Cannot open telemetry file: " << value << std::endl;
+			exit(1);
+		}
+	}
+	else if (name == "--telemetry-interval") {
+		fp.IO_conf.telemetry_interval = std::stod(value);
+
+		// sanity check for positive interval
+		if (fp.IO_conf.telemetry_interval <= 0.0) {
+			std::cout << "IO> Provide a positive telemetry interval!" << std::endl;
+			exit(1);
+		}
+	}
+	else if (name == "--checkpoint") {
+		fp.IO_conf.checkpoint_file = value;
+	}
+	else if (name == "--checkpoint-interval") {
+		fp.IO_conf.checkpoint_interval = std::stod(value);
+
+		// sanity check for non-negative interval; zero triggers
+		// checkpoints for each temperature step
+		if (fp.IO_conf.checkpoint_interval < 0.0) {
+			std::cout << "IO> Provide a non-negative checkpoint interval!" << std::endl;
+			exit(1);
+		}
+	}
+	else if (name == "--output-dir") {
+		fp.IO_conf.output_dir = value;
+
+		// all output files are named by concatenation
+		if (!fp.IO_conf.output_dir.empty() && fp.IO_conf.output_dir.back() != '/') {
+			fp.IO_conf.output_dir += "/";
+		}
+
+		// create directory, if not existing yet; accessibility is
+		// tested along w/ the results file
+		mkdir(fp.IO_conf.output_dir.c_str(), 0755);
+	}
+	else if (name == "--resume") {
+		fp.IO_conf.checkpoint_in.open(value);
+
+		if (!fp.IO_conf.checkpoint_in.good()) {
+			std::cout << "IO> No such checkpoint file: " << value << std::endl;
+			exit(1);
+		}
+	}
+	else {
+		std::cout << "IO> Unknown optional parameter ``" << name << "''" << std::endl;
+		exit(1);
+	}
+}
+
+/// parse config and technology files; the path of the technology file is relative to the
+/// config file
+void IO::parseConfigFiles(FloorPlanner& fp, std::string const& config_file, double const& TSV_density, int const& log_override) {
+	int file_version;
+	size_t last_slash;
+	std::ifstream in;
+	std::string technology_file;
+	std::string tmpstr;
+	ThermalAnalyzer::MaskParameters mask_parameters;
+
+	// determine path of technology file; same as config file per definition
+	last_slash = config_file.find_last_of('/');
+	if (last_slash == std::string::npos) {
+		technology_file = "";
+	}
+	else {
+		technology_file = config_file.substr(0, last_slash) + "/";
 	}
 
+	mask_parameters.TSV_density = TSV_density;
+
 	// config file parsing
 	//
 	in.open(config_file.c_str());
@@ -281,6 +524,10 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	while (tmpstr != "value" && !in.eof())
 		in >> tmpstr;
 	in >> fp.log;
+	// log level may be defined by caller, e.g., by the embeddable API
+	if (log_override >= 0) {
+		fp.log = log_override;
+	}
 
 	in >> tmpstr;
 	while (tmpstr != "value" && !in.eof())
@@ -1008,6 +1255,48 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		// SA loop setup
 		std::cout << "IO>  SA -- Inner-loop operation-factor a (ops = N^a for N blocks): " << fp.schedule.loop_factor << std::endl;
 		std::cout << "IO>  SA -- Outer-loop upper limit: " << fp.schedule.loop_limit << std::endl;
+		if (fp.schedule.fixed_seed) {
+			std::cout << "IO>  SA -- Fixed seed for random-number generator: " << fp.schedule.seed << std::endl;
+		}
+		if (fp.schedule.time_budget > 0.0) {
+			std::cout << "IO>  SA -- Time budget [s]: " << fp.schedule.time_budget << std::endl;
+		}
+		if (fp.schedule.stop_steps > 0) {
+			std::cout << "IO>  SA -- Convergence-based termination; temperature steps: " << fp.schedule.stop_steps << std::endl;
+		}
+		if (fp.schedule.adaptive_inner_loop) {
+			std::cout << "IO>  SA -- Inner-loop length adapted to acceptance ratio: " << fp.schedule.adaptive_inner_loop << std::endl;
+		}
+		if (fp.layoutOp.parameters.partitioning_init) {
+			std::cout << "IO>  SA -- Initial die assignment by min-cut partitioning: " << fp.layoutOp.parameters.partitioning_init << std::endl;
+		}
+		if (fp.layoutOp.parameters.placement_init) {
+			std::cout << "IO>  SA -- Initial CBL tuples by analytical placement: " << fp.layoutOp.parameters.placement_init << std::endl;
+		}
+		if (fp.schedule.speculative_moves > 0) {
+			std::cout << "IO>  SA -- Speculative moves; candidates evaluated in parallel: " << fp.schedule.speculative_moves << std::endl;
+		}
+		if (fp.schedule.sampling_walks > 0) {
+			std::cout << "IO>  SA -- Parallel sampling; independent random walks: " << fp.schedule.sampling_walks << std::endl;
+		}
+		if (fp.schedule.sampling_confidence > 0.0) {
+			std::cout << "IO>  SA -- Reduced-sample estimator for sampling; relative half-width of confidence interval: " << fp.schedule.sampling_confidence << std::endl;
+		}
+		if (fp.schedule.warm_start) {
+			std::cout << "IO>  SA -- Warm start; refinement of given solution file" << std::endl;
+		}
+		if (fp.schedule.pareto_archive > 0) {
+			std::cout << "IO>  SA -- Pareto archive; max solutions: " << fp.schedule.pareto_archive << std::endl;
+		}
+		if (fp.schedule.multilevel > 0) {
+			std::cout << "IO>  SA -- Multilevel floorplanning; coarsening levels: " << fp.schedule.multilevel << std::endl;
+		}
+		if (fp.IO_conf.telemetry.is_open()) {
+			std::cout << "IO>  SA -- Telemetry interval [s]: " << fp.IO_conf.telemetry_interval << std::endl;
+		}
+		if (!fp.IO_conf.output_dir.empty()) {
+			std::cout << "IO>  SA -- Output directory: " << fp.IO_conf.output_dir << std::endl;
+		}
 
 		// SA cooling schedule
 		std::cout << "IO>  SA -- Start temperature scaling factor: " << fp.schedule.temp_init_factor << std::endl;
@@ -1066,6 +1355,11 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 
 /// parse Corblivar solution file, to rerun Corbliar w/ previous data
 void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
+	IO::parseCorblivarFile(fp, corb, fp.IO_conf.solution_in);
+}
+
+/// parse Corblivar solution from given stream, either file stream or in-memory data
+void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb, std::istream& solution_in) {
 	std::string tmpstr;
 	CornerBlockList::Tuple tuple;
 	unsigned tuples;
@@ -1073,57 +1367,79 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 	std::string block_id;
 	unsigned dir;
 	double width, height;
+	std::vector<bool> blocks_parsed;
+	int die;
 
 	if (fp.logMed()) {
 		std::cout << "IO> ";
 		std::cout << "Initializing Corblivar data from solution file ..." << std::endl;
 	}
 
+	blocks_parsed.assign(fp.blocks.size(), false);
+
 	// drop solution file header
-	while (tmpstr != "data_start" && !fp.IO_conf.solution_in.eof()) {
-		fp.IO_conf.solution_in >> tmpstr;
+	while (tmpstr != "data_start" && !solution_in.eof()) {
+		solution_in >> tmpstr;
 	}
 
 	tuples = 0;
 	cur_layer = -1;
 
-	while (!fp.IO_conf.solution_in.eof()) {
-		fp.IO_conf.solution_in >> tmpstr;
+	while (!solution_in.eof()) {
+		solution_in >> tmpstr;
 
 		// new die; new CBL
 		if (tmpstr == "CBL") {
 			// drop "["
-			fp.IO_conf.solution_in >> tmpstr;
+			solution_in >> tmpstr;
 
 			// layer id
-			fp.IO_conf.solution_in >> cur_layer;
+			solution_in >> cur_layer;
 
 			// drop "]"
-			fp.IO_conf.solution_in >> tmpstr;
+			solution_in >> tmpstr;
 		}
 		// new CBL tuple; new block
 		else if (tmpstr == "tuple") {
 			// drop tuple id
-			fp.IO_conf.solution_in >> tmpstr;
+			solution_in >> tmpstr;
 			// drop ":"
-			fp.IO_conf.solution_in >> tmpstr;
+			solution_in >> tmpstr;
 			// drop "("
-			fp.IO_conf.solution_in >> tmpstr;
+			solution_in >> tmpstr;
 
 			// block id
-			fp.IO_conf.solution_in >> block_id;
+			solution_in >> block_id;
 			// find related block
 			tuple.S = Block::findBlock(block_id, fp.blocks);
 			if (tuple.S == nullptr) {
+
+				// for warm starts, blocks removed from the benchmark are
+				// dropped; i.e., drop direction, T-junctions, width,
+				// height, and ");"
+				if (fp.schedule.warm_start) {
+
+					if (fp.logMed()) {
+						std::cout << "IO>  Block " << block_id << " is not part of the benchmark anymore; drop tuple" << std::endl;
+					}
+
+					for (int i = 0; i < 5; i++) {
+						solution_in >> tmpstr;
+					}
+
+					continue;
+				}
+
 				std::cout << "IO> Block " << block_id << " cannot be retrieved; ensure solution file and benchmark file match!" << std::endl;
 				exit(1);
 			}
+			blocks_parsed[tuple.S - fp.blocks.data()] = true;
 
 			// memorize layer in block itself
 			tuple.S->layer = cur_layer;
 
 			// direction L
-			fp.IO_conf.solution_in >> dir;
+			solution_in >> dir;
 			// parse direction; unsigned 
 			if (dir == static_cast<unsigned>(Direction::VERTICAL)) {
 				tuple.L = Direction::VERTICAL;
@@ -1133,13 +1449,32 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 			}
 
 			// T-junctions
-			fp.IO_conf.solution_in >> tuple.T;
+			solution_in >> tuple.T;
 
 			// block width
-			fp.IO_conf.solution_in >> width;
+			solution_in >> width;
 
 			// block height
-			fp.IO_conf.solution_in >> height;
+			solution_in >> height;
+
+			// for warm starts, the block's area may differ from the solution;
+			// then, only the AR of soft blocks and the orientation of hard
+			// blocks are considered
+			if (fp.schedule.warm_start && std::abs(width * height - tuple.S->bb.area) > IO::WARM_START_AREA_TOLERANCE * tuple.S->bb.area) {
+
+				if (tuple.S->soft) {
+					width = std::sqrt(tuple.S->bb.area * width / height);
+					height = tuple.S->bb.area / width;
+				}
+				else if ((width > height) == (tuple.S->bb.w > tuple.S->bb.h)) {
+					width = tuple.S->bb.w;
+					height = tuple.S->bb.h;
+				}
+				else {
+					width = tuple.S->bb.h;
+					height = tuple.S->bb.w;
+				}
+			}
 
 			// reshape block accordingly
 			tuple.S->bb.ur.x = tuple.S->bb.ll.x + width;
@@ -1151,7 +1486,7 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 			tuple.S->base_delay = TimingPowerAnalyser::baseDelay(height, width);
 
 			// drop ");"
-			fp.IO_conf.solution_in >> tmpstr;
+			solution_in >> tmpstr;
 
 			// sanity check for same number of dies
 			if (cur_layer > fp.getLayers() - 1) {
@@ -1165,6 +1500,32 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 		}
 	}
 
+	// for warm starts, blocks added to the benchmark are inserted randomly, as for
+	// CorblivarCore::initCorblivarRandomly
+	if (fp.schedule.warm_start) {
+
+		for (unsigned b = 0; b < fp.blocks.size(); b++) {
+
+			if (blocks_parsed[b]) {
+				continue;
+			}
+
+			if (fp.logMed()) {
+				std::cout << "IO>  Block " << fp.blocks[b].id << " is not part of the solution; insert tuple randomly" << std::endl;
+			}
+
+			die = Math::randI(0, fp.getLayers());
+
+			tuple.S = &fp.blocks[b];
+			tuple.S->layer = die;
+			tuple.L = Math::randB() ? Direction::HORIZONTAL : Direction::VERTICAL;
+			tuple.T = 0;
+
+			corb.editDie(die).editCBL().insert(std::move(tuple));
+			tuples++;
+		}
+	}
+
 	// sanity check for same number of blocks
 	if (fp.getBlocks().size() != tuples) {
 		std::cout << "IO> Parsing error: solution file contains " << tuples << " tuples/blocks; read in benchmark contains " << fp.getBlocks().size() << " blocks!" << std::endl;
@@ -1180,6 +1541,22 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 /// parse alignment-requests file
 void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments) {
 	std::ifstream al_in;
+
+	// sanity check for unavailable file
+	if (!fp.IO_conf.alignments_file_avail) {
+		return;
+	}
+
+	// open file
+	al_in.open(fp.IO_conf.alignments_file.c_str());
+
+	IO::parseAlignmentRequests(fp, alignments, al_in);
+
+	al_in.close();
+}
+
+/// parse alignment requests from given stream, either file stream or in-memory data
+void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments, std::istream& al_in) {
 	std::string tmpstr;
 	int id;
 	std::string block_id;
@@ -1194,19 +1571,11 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 	double alignment_x;
 	double alignment_y;
 
-	// sanity check for unavailable file
-	if (!fp.IO_conf.alignments_file_avail) {
-		return;
-	}
-
 	if (fp.logMed()) {
 		std::cout << "IO> ";
 		std::cout << "Parsing alignment requests..." << std::endl;
 	}
 
-	// open file
-	al_in.open(fp.IO_conf.alignments_file.c_str());
-
 	// reset alignments
 	alignments.clear();
 
@@ -1389,6 +1758,32 @@ void IO::parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignment
 /// parse blocks file
 void IO::parseBlocks(FloorPlanner& fp) {
 	std::ifstream blocks_in, pins_in, power_in;
+
+	// open GT benchmark files
+	if (fp.IO_conf.GT_benchmark) {
+		blocks_in.open(fp.IO_conf.GT_fp_file.c_str());
+		// (TODO) handle individual pins for each block
+		//pins_in.open(fp.IO_conf.GT_pins_file.c_str());
+		power_in.open(fp.IO_conf.GT_power_file.c_str());
+	}
+	// open GSRC benchmark files
+	else {
+		blocks_in.open(fp.IO_conf.blocks_file.c_str());
+		pins_in.open(fp.IO_conf.pins_file.c_str());
+		power_in.open(fp.IO_conf.power_density_file.c_str());
+	}
+
+	IO::parseBlocks(fp, blocks_in, pins_in, power_in);
+
+	// close files
+	blocks_in.close();
+	power_in.close();
+	pins_in.close();
+}
+
+/// parse blocks and terminal pins from given streams, either file streams or in-memory
+/// data
+void IO::parseBlocks(FloorPlanner& fp, std::istream& blocks_in, std::istream& pins_in, std::istream& power_in) {
 	std::string tmpstr;
 	double power = 0.0;
 	double blocks_max_area = 0.0, blocks_avg_area = 0.0;
@@ -1407,20 +1802,6 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		std::cout << "Parsing blocks..." << std::endl;
 	}
 
-	// open GT benchmark files
-	if (fp.IO_conf.GT_benchmark) {
-		blocks_in.open(fp.IO_conf.GT_fp_file.c_str());
-		// (TODO) handle individual pins for each block
-		//pins_in.open(fp.IO_conf.GT_pins_file.c_str());
-		power_in.open(fp.IO_conf.GT_power_file.c_str());
-	}
-	// open GSRC benchmark files
-	else {
-		blocks_in.open(fp.IO_conf.blocks_file.c_str());
-		pins_in.open(fp.IO_conf.pins_file.c_str());
-		power_in.open(fp.IO_conf.power_density_file.c_str());
-	}
-
 	// drop power density file header line
 	if (fp.IO_conf.power_density_file_avail) {
 		while (tmpstr != "end" && !power_in.eof())
@@ -1798,11 +2179,6 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		fp.blocks.push_back(std::move(new_block));
 	}
 
-	// close files
-	blocks_in.close();
-	power_in.close();
-	pins_in.close();
-
 	// determine deadspace amount for whole stack, now that the occupied blocks area
 	// is known
 	fp.IC.stack_deadspace = fp.IC.stack_area - fp.IC.blocks_area;
@@ -1895,6 +2271,25 @@ void IO::parseBlocks(FloorPlanner& fp) {
 /// parse nets file
 void IO::parseNets(FloorPlanner& fp) {
 	std::ifstream in;
+
+	// open nets file
+	//
+	// GSRC, separate file
+	if (!fp.IO_conf.GT_benchmark) {
+		in.open(fp.IO_conf.nets_file.c_str());
+	}
+	// GATech, open floorplan file which also contains the nets
+	else {
+		in.open(fp.IO_conf.GT_fp_file.c_str());
+	}
+
+	IO::parseNets(fp, in);
+
+	in.close();
+}
+
+/// parse nets from given stream, either file stream or in-memory data
+void IO::parseNets(FloorPlanner& fp, std::istream& in) {
 	std::string tmpstr;
 	int i, net_degree;
 	std::string net_block;
@@ -1914,18 +2309,6 @@ void IO::parseNets(FloorPlanner& fp) {
 	// reset nets
 	fp.nets.clear();
 
-	// open nets file
-	//
-	// GSRC, separate file
-	if (!fp.IO_conf.GT_benchmark) {
-		in.open(fp.IO_conf.nets_file.c_str());
-	}
-	// GATech, open floorplan file which also contains the nets
-	else {
-		in.open(fp.IO_conf.GT_fp_file.c_str());
-	}
-
-
 	// drop other parts, until nets section is reached
 	//
 	// GSRC
@@ -2139,9 +2522,6 @@ void IO::parseNets(FloorPlanner& fp) {
 		fp.nets.push_back(std::move(new_net));
 	}
 
-	// close nets file
-	in.close();
-
 	if (IO::DBG) {
 		for (Net const& n : fp.nets) {
 			std::cout << "DBG_IO> ";
@@ -2290,11 +2670,11 @@ void IO::writeMaps(FloorPlanner& fp, int const& flag_parameter, std::string cons
 			}
 
 			// init file stream for gnuplot script
-			gp_out.open(gp_out_name.str().c_str());
+			gp_out.open((fp.IO_conf.output_dir + gp_out_name.str()).c_str());
 			// init file stream for data file;
 			// don't open (overwrite) for HotSpot data
 			if (flag != MAPS_FLAGS::THERMAL_HOTSPOT) {
-				data_out.open(data_out_name.str().c_str());
+				data_out.open((fp.IO_conf.output_dir + data_out_name.str()).c_str());
 			}
 
 			// file header for data file
@@ -2745,9 +3125,9 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	data_out_name << fp.benchmark << "_TempSchedule.data";
 
 	// init file stream for gnuplot script
-	gp_out.open(gp_out_name.str().c_str());
+	gp_out.open((fp.IO_conf.output_dir + gp_out_name.str()).c_str());
 	// init file stream for data file
-	data_out.open(data_out_name.str().c_str());
+	data_out.open((fp.IO_conf.output_dir + data_out_name.str()).c_str());
 
 	// output data: SA step and SA temp
 	data_out << "# Step Temperature (index 0)" << std::endl;
@@ -2912,6 +3292,619 @@ void IO::writeTempSchedule(FloorPlanner const& fp) {
 	}
 }
 
+/// the archived solutions are written as regular solution files, ordered by packing
+/// density; they can be evaluated in detail by running Corblivar w/ such a solution file
+void IO::writeParetoArchive(FloorPlanner const& fp) {
+	std::ofstream out, solution_out;
+	std::vector<FloorPlanner::ParetoSolution const*> solutions;
+	unsigned s, i;
+	int d;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Writing Pareto archive ..." << std::endl;
+	}
+
+	// order solutions by first criterion, i.e., packing density
+	for (FloorPlanner::ParetoSolution const& solution : fp.paretoArchive) {
+		solutions.push_back(&solution);
+	}
+	std::sort(solutions.begin(), solutions.end(), [](FloorPlanner::ParetoSolution const* a, FloorPlanner::ParetoSolution const* b) {
+			return a->criteria < b->criteria;
+		});
+
+	// summary file
+	std::stringstream out_name;
+	out_name << fp.benchmark << ".pareto";
+	out.open((fp.IO_conf.output_dir + out_name.str()).c_str());
+
+	out << "# Corblivar Pareto archive; non-dominated solutions fitting into the outline, as found during SA" << std::endl;
+	out << "# values as evaluated during SA, i.e., w/o final TSV clustering; criteria w/o optimization are 0" << std::endl;
+	out << "# solution_file SA_step area_deadspace HPWL routing_util TSVs max_temp timing alignments_mismatch thermal_leakage_correlation" << std::endl;
+
+	for (s = 0; s < solutions.size(); s++) {
+
+		std::stringstream solution_name;
+		solution_name << fp.benchmark << "_pareto_" << s + 1 << ".solution";
+
+		out << solution_name.str() << " " << solutions[s]->step;
+		for (double const& criterion : solutions[s]->criteria) {
+			out << " " << criterion;
+		}
+		out << std::endl;
+
+		// solution file; format as for CorblivarCore::CBLsString
+		solution_out.open((fp.IO_conf.output_dir + solution_name.str()).c_str());
+
+		solution_out << "# tuple format: ( BLOCK_ID DIRECTION T-JUNCTS BLOCK_WIDTH BLOCK_HEIGHT )" << std::endl;
+		solution_out << "data_start" << std::endl;
+
+		for (d = 0; d < fp.IC.layers; d++) {
+
+			solution_out << "CBL [ " << d << " ]" << std::endl;
+
+			for (i = 0; i < solutions[s]->CBLs[d].size(); i++) {
+
+				FloorPlanner::ParetoTuple const& tuple = solutions[s]->CBLs[d][i];
+
+				solution_out << "tuple " << i << " : ";
+				solution_out << "( " << fp.blocks[tuple.block].id << " " << static_cast<unsigned>(tuple.L) << " " << tuple.T << " ";
+				solution_out << tuple.w << " " << tuple.h << " ); ";
+			}
+			solution_out << std::endl;
+		}
+		solution_out << std::endl;
+
+		solution_out.close();
+	}
+
+	out.close();
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; " << solutions.size() << " solutions" << std::endl << std::endl;
+	}
+}
+
+/// generate machine-readable report, i.e., one line of JSON covering run statistics and
+/// final results; required for regression runs, see exp/regression.sh
+void IO::writeReport(FloorPlanner const& fp, bool const& overall_cost) {
+	std::ofstream report_out;
+	std::stringstream report_out_name;
+	FloorPlanner::Cost const& cost = fp.SA_stats.cost;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Generating report ..." << std::endl;
+	}
+
+	report_out_name << fp.benchmark << "_report.json";
+	report_out.open((fp.IO_conf.output_dir + report_out_name.str()).c_str());
+
+	report_out << "{";
+	report_out << "\"benchmark\": \"" << fp.benchmark << "\"";
+	if (fp.schedule.fixed_seed) {
+		report_out << ", \"seed\": " << fp.schedule.seed;
+	}
+	else {
+		report_out << ", \"seed\": null";
+	}
+	report_out << ", \"time_budget\": " << fp.schedule.time_budget;
+	report_out << ", \"runtime\": " << fp.SA_stats.runtime;
+	report_out << ", \"SA_runtime\": " << fp.SA_stats.SA_runtime;
+	report_out << ", \"SA_steps\": " << fp.tempSchedule.size();
+	report_out << ", \"SA_moves\": " << fp.SA_stats.moves;
+	report_out << ", \"SA_converged\": " << (fp.SA_stats.converged ? "true" : "false");
+	if (fp.SA_stats.SA_runtime > 0.0) {
+		report_out << ", \"moves_per_s\": " << fp.SA_stats.moves / fp.SA_stats.SA_runtime;
+	}
+	else {
+		report_out << ", \"moves_per_s\": 0";
+	}
+	report_out << ", \"valid_solution\": " << (fp.SA_stats.valid_solution ? "true" : "false");
+
+	// cost terms; consider non-normalized, actual values
+	if (fp.SA_stats.valid_solution) {
+
+		// overall cost only encode a useful number in case the whole
+		// optimization run is done
+		if (overall_cost) {
+			report_out << ", \"cost\": " << cost.total_cost;
+		}
+		else {
+			report_out << ", \"cost\": null";
+		}
+		report_out << ", \"packing_overhead\": " << cost.area_actual_value;
+		report_out << ", \"deadspace\": " << 100.0 * (fp.IC.stack_deadspace / fp.IC.stack_area);
+		report_out << ", \"die_w\": " << fp.IC.outline_x;
+		report_out << ", \"die_h\": " << fp.IC.outline_y;
+		report_out << ", \"HPWL\": " << cost.HPWL_actual_value;
+		report_out << ", \"TSVs\": " << cost.TSVs_actual_value;
+		report_out << ", \"power\": " << cost.power_blocks + cost.power_wires + cost.power_TSVs;
+		if (fp.opt_flags.routing_util) {
+			report_out << ", \"routing_util\": " << cost.routing_util_actual_value;
+		}
+		if (fp.opt_flags.thermal) {
+			report_out << ", \"thermal\": " << cost.thermal_actual_value;
+		}
+		if (fp.opt_flags.alignment) {
+			report_out << ", \"alignments\": " << cost.alignments_actual_value;
+		}
+		if (fp.opt_flags.timing || fp.opt_flags.voltage_assignment) {
+			report_out << ", \"timing\": " << cost.timing_actual_value;
+		}
+		if (fp.opt_flags.voltage_assignment) {
+			report_out << ", \"voltage_assignment_power_saving\": " << cost.voltage_assignment_power_saving;
+		}
+		if (fp.opt_flags.thermal_leakage) {
+			report_out << ", \"thermal_leakage_entropy\": " << cost.thermal_leakage_entropy_actual_value;
+			report_out << ", \"thermal_leakage_correlation\": " << cost.thermal_leakage_correlation_actual_value;
+		}
+	}
+
+	report_out << "}" << std::endl;
+
+	// close file stream
+	report_out.close();
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done" << std::endl << std::endl;
+	}
+}
+
+/// write SA checkpoint; covers the state of the main SA loop at the beginning of a
+/// temperature step, along w/ all data of the FloorPlanner and CorblivarCore instances
+/// which is altered during SA, i.e., current and best CBLs, block shapes, max-cost
+/// normalizers, die outline, terminal pins, the state of the random-number generator,
+/// and the temperature schedule; resuming from the checkpoint reproduces the
+/// remaining SA run bit-exactly, except for time-budgeted runs
+///
+/// the checkpoint is written into a temporary file first which is then renamed, such
+/// that an interrupted run never leaves an incomplete checkpoint behind
+void IO::writeCheckpoint(FloorPlanner const& fp, CorblivarCore const& corb) {
+	std::ofstream out;
+	std::string tmp_file;
+	struct FloorPlanner::SA_checkpoint const& state = fp.SA_checkpoint;
+
+	if (fp.logMax()) {
+		std::cout << "IO> ";
+		std::cout << "Writing SA checkpoint for step " << state.step << " ..." << std::endl;
+	}
+
+	tmp_file = fp.IO_conf.checkpoint_file + ".tmp";
+	out.open(tmp_file.c_str());
+
+	if (!out.good()) {
+		std::cout << "IO> Cannot write SA checkpoint: " << tmp_file << std::endl;
+		return;
+	}
+
+	// doubles are written w/ full precision, such that they are read in
+	// bit-exactly
+	out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+	out << "# Corblivar SA checkpoint; resume w/ same benchmark, config, and parameters" << std::endl;
+	out << "version " << IO::CHECKPOINT_VERSION << std::endl;
+	out << "benchmark " << fp.benchmark << std::endl;
+	out << "layers " << fp.IC.layers << std::endl;
+	out << "blocks " << fp.blocks.size() << std::endl;
+
+	// state of main SA loop
+	out << "SA_state";
+	out << " " << state.step;
+	out << " " << state.loop_limit;
+	out << " " << state.innerLoopMax;
+	out << " " << state.innerLoopMax_regular;
+	out << " " << state.temp;
+	out << " " << state.cooling_phase;
+	out << " " << state.SA_phase_two;
+	out << " " << state.fitting_layouts_ratio;
+	out << " " << state.valid_layout_found;
+	out << " " << state.step_valid_layout_found;
+	out << " " << state.best_cost;
+	out << " " << state.moves_per_s;
+	out << " " << state.elapsed;
+	out << " " << fp.SA_stats.moves;
+	out << std::endl;
+
+	// best-solution cost terms; only relevant for SA telemetry
+	out << "best_cost_terms";
+	if (state.valid_layout_found) {
+		FloorPlanner::Cost const& c = state.best_cost_terms;
+
+		out << " " << c.total_cost << " " << c.area_outline << " " << c.HPWL << " " << c.routing_util << " " << c.TSVs;
+		out << " " << c.alignments << " " << c.thermal << " " << c.timing << " " << c.voltage_assignment << " " << c.thermal_leakage;
+	}
+	out << std::endl;
+
+	// max-cost normalizers
+	out << "max_cost";
+	out << " " << fp.max_cost_thermal;
+	out << " " << fp.max_cost_WL;
+	out << " " << fp.max_cost_alignments;
+	out << " " << fp.max_cost_routing_util;
+	out << " " << fp.max_cost_timing;
+	out << " " << fp.max_cost_voltage_assignment;
+	out << " " << fp.max_cost_thermal_leakage;
+	out << " " << fp.max_cost_TSVs;
+	out << std::endl;
+	out << "max_values_voltage_assignment";
+	out << " " << fp.voltageAssignment.max_values.inv_power_saving;
+	out << " " << fp.voltageAssignment.max_values.corners_avg;
+	out << " " << fp.voltageAssignment.max_values.module_count;
+	out << " " << fp.voltageAssignment.max_values.level_shifter;
+	out << " " << fp.voltageAssignment.max_values.power_variation_max;
+	out << std::endl;
+	out << "max_values_leakage";
+	out << " " << fp.leakageAnalyzer.max_values.entropy;
+	out << " " << fp.leakageAnalyzer.max_values.correlation;
+	out << std::endl;
+
+	// die outline, possibly shrunk, and dynamically adapted timing threshold
+	out << "IC";
+	out << " " << fp.IC.outline_x;
+	out << " " << fp.IC.outline_y;
+	out << " " << fp.IC.die_AR;
+	out << " " << fp.IC.die_area;
+	out << " " << fp.IC.stack_area;
+	out << " " << fp.IC.stack_deadspace;
+	out << " " << fp.IC.delay_threshold;
+	out << std::endl;
+
+	// block-selection guidance; index of largest net, -1 for none
+	out << "largest_net ";
+	if (fp.layoutOp.parameters.largest_net == nullptr) {
+		out << -1;
+	}
+	else {
+		out << fp.layoutOp.parameters.largest_net - fp.nets.data();
+	}
+	out << std::endl;
+
+	// statistics of layout operations, for both SA phases; note that the quality
+	// estimates drive the adaptive selection of operations
+	out << "op_stats";
+	for (auto const& phase_stats : fp.layoutOp.op_stats) {
+		for (LayoutOperations::OpStats const& stats : phase_stats) {
+			out << " " << stats.evaluated << " " << stats.accepted << " " << stats.improvement << " " << stats.runtime << " " << stats.quality;
+		}
+	}
+	out << std::endl;
+
+	// state of random-number generator
+	out << "RNG " << Math::randEngine() << std::endl;
+
+	// temperature schedule
+	out << "temp_schedule " << fp.tempSchedule.size() << std::endl;
+	for (FloorPlanner::TempStep const& step : fp.tempSchedule) {
+		out << step.step << " " << step.temp << " " << step.avg_cost << " " << step.new_best_sol_found << " " << step.cost_best_sol;
+		out << " " << step.inner_loop_max << " " << step.accepted_ops_ratio << std::endl;
+	}
+
+	// terminal pins, possibly scaled to shrunk outline
+	out << "terminals " << fp.terminals.size() << std::endl;
+	for (Pin const& pin : fp.terminals) {
+		out << pin.bb.ll.x << " " << pin.bb.ll.y << std::endl;
+	}
+
+	// block shapes; current and best solution
+	out << "shapes " << fp.blocks.size() << std::endl;
+	for (Block const& b : fp.blocks) {
+		out << b.id;
+		for (Rect const* bb : {&b.bb, &b.bb_best}) {
+			out << " " << bb->ll.x << " " << bb->ll.y << " " << bb->ur.x << " " << bb->ur.y << " " << bb->w << " " << bb->h;
+		}
+		out << std::endl;
+	}
+
+	// current and best CBLs; tuple format: ( BLOCK_ID DIRECTION T-JUNCTS )
+	for (int d = 0; d < fp.IC.layers; d++) {
+
+		for (CornerBlockList const* CBL : {&corb.getDie(d).CBL, &corb.getDie(d).CBLbest}) {
+
+			out << (CBL == &corb.getDie(d).CBL ? "CBL " : "CBL_best ") << d << " " << CBL->size() << std::endl;
+
+			for (unsigned t = 0; t < CBL->size(); t++) {
+				out << CBL->S[t]->id << " " << static_cast<unsigned>(CBL->L[t]) << " " << CBL->T[t] << std::endl;
+			}
+		}
+	}
+
+	out << "checkpoint_end" << std::endl;
+	out.close();
+
+	// replace previous checkpoint
+	if (std::rename(tmp_file.c_str(), fp.IO_conf.checkpoint_file.c_str()) != 0) {
+		std::cout << "IO> Cannot write SA checkpoint: " << fp.IO_conf.checkpoint_file << std::endl;
+	}
+}
+
+/// parse SA checkpoint, to resume SA; see IO::writeCheckpoint
+void IO::parseCheckpoint(FloorPlanner& fp, CorblivarCore& corb) {
+	std::ifstream& in = fp.IO_conf.checkpoint_in;
+	std::string tmpstr;
+	struct FloorPlanner::SA_checkpoint& state = fp.SA_checkpoint;
+	unsigned count;
+	int version, layers, largest_net, cooling_phase;
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Resuming SA from checkpoint ..." << std::endl;
+	}
+
+	// helper to check for expected keyword
+	auto expect = [&](std::string const& keyword) {
+		in >> tmpstr;
+
+		if (tmpstr != keyword) {
+			std::cout << "IO> Parsing error in checkpoint: expected ``" << keyword << "'', found ``" << tmpstr << "''" << std::endl;
+			exit(1);
+		}
+	};
+	// helper to read doubles; strtod also handles inf and nan
+	auto readDouble = [&](double& value) {
+		in >> tmpstr;
+		value = std::strtod(tmpstr.c_str(), nullptr);
+	};
+	// helper to look up blocks
+	auto findBlock = [&](std::string const& id) {
+		Block const* b = Block::findBlock(id, fp.blocks);
+
+		if (b == nullptr) {
+			std::cout << "IO> Block " << id << " cannot be retrieved; ensure checkpoint and benchmark file match!" << std::endl;
+			exit(1);
+		}
+
+		return b;
+	};
+
+	// drop header
+	while (tmpstr != "version" && !in.eof()) {
+		in >> tmpstr;
+	}
+	in >> version;
+	if (version != IO::CHECKPOINT_VERSION) {
+		std::cout << "IO> Checkpoint version " << version << " not supported; expected version " << IO::CHECKPOINT_VERSION << std::endl;
+		exit(1);
+	}
+
+	// sanity checks for same setup
+	expect("benchmark");
+	in >> tmpstr;
+	if (tmpstr != fp.benchmark) {
+		std::cout << "IO> Checkpoint is for benchmark " << tmpstr << ", not for " << fp.benchmark << "!" << std::endl;
+		exit(1);
+	}
+	expect("layers");
+	in >> layers;
+	if (layers != fp.IC.layers) {
+		std::cout << "IO> Checkpoint is for " << layers << " dies; config file is set for " << fp.IC.layers << " dies!" << std::endl;
+		exit(1);
+	}
+	expect("blocks");
+	in >> count;
+	if (count != fp.blocks.size()) {
+		std::cout << "IO> Checkpoint is for " << count << " blocks; read in benchmark contains " << fp.blocks.size() << " blocks!" << std::endl;
+		exit(1);
+	}
+
+	// state of main SA loop
+	expect("SA_state");
+	in >> state.step;
+	in >> state.loop_limit;
+	in >> state.innerLoopMax;
+	in >> state.innerLoopMax_regular;
+	readDouble(state.temp);
+	in >> cooling_phase;
+	state.cooling_phase = static_cast<FloorPlanner::TempPhase>(cooling_phase);
+	in >> state.SA_phase_two;
+	readDouble(state.fitting_layouts_ratio);
+	in >> state.valid_layout_found;
+	in >> state.step_valid_layout_found;
+	readDouble(state.best_cost);
+	readDouble(state.moves_per_s);
+	readDouble(state.elapsed);
+	in >> fp.SA_stats.moves;
+
+	expect("best_cost_terms");
+	if (state.valid_layout_found) {
+		FloorPlanner::Cost& c = state.best_cost_terms;
+
+		readDouble(c.total_cost);
+		readDouble(c.area_outline);
+		readDouble(c.HPWL);
+		readDouble(c.routing_util);
+		readDouble(c.TSVs);
+		readDouble(c.alignments);
+		readDouble(c.thermal);
+		readDouble(c.timing);
+		readDouble(c.voltage_assignment);
+		readDouble(c.thermal_leakage);
+	}
+
+	// max-cost normalizers
+	expect("max_cost");
+	readDouble(fp.max_cost_thermal);
+	readDouble(fp.max_cost_WL);
+	readDouble(fp.max_cost_alignments);
+	readDouble(fp.max_cost_routing_util);
+	readDouble(fp.max_cost_timing);
+	readDouble(fp.max_cost_voltage_assignment);
+	readDouble(fp.max_cost_thermal_leakage);
+	in >> fp.max_cost_TSVs;
+	expect("max_values_voltage_assignment");
+	readDouble(fp.voltageAssignment.max_values.inv_power_saving);
+	readDouble(fp.voltageAssignment.max_values.corners_avg);
+	in >> fp.voltageAssignment.max_values.module_count;
+	in >> fp.voltageAssignment.max_values.level_shifter;
+	readDouble(fp.voltageAssignment.max_values.power_variation_max);
+	expect("max_values_leakage");
+	readDouble(fp.leakageAnalyzer.max_values.entropy);
+	readDouble(fp.leakageAnalyzer.max_values.correlation);
+
+	// die outline and timing threshold
+	expect("IC");
+	readDouble(fp.IC.outline_x);
+	readDouble(fp.IC.outline_y);
+	readDouble(fp.IC.die_AR);
+	readDouble(fp.IC.die_area);
+	readDouble(fp.IC.stack_area);
+	readDouble(fp.IC.stack_deadspace);
+	readDouble(fp.IC.delay_threshold);
+
+	// the die outline may have been shrunk; reset the power maps and the
+	// routing-estimation maps accordingly, see FloorPlanner::shrinkDieOutlines
+	fp.thermalAnalyzer.initPowerMaps(fp.IC.layers, fp.getOutline());
+	fp.routingUtil.initUtilMaps(fp.IC.layers, fp.getOutline());
+
+	expect("largest_net");
+	in >> largest_net;
+	if (largest_net == -1) {
+		fp.layoutOp.parameters.largest_net = nullptr;
+	}
+	else {
+		fp.layoutOp.parameters.largest_net = &fp.nets[largest_net];
+	}
+
+	// statistics of layout operations
+	expect("op_stats");
+	for (auto& phase_stats : fp.layoutOp.op_stats) {
+		for (LayoutOperations::OpStats& stats : phase_stats) {
+			in >> stats.evaluated;
+			in >> stats.accepted;
+			readDouble(stats.improvement);
+			readDouble(stats.runtime);
+			readDouble(stats.quality);
+		}
+	}
+
+	// state of random-number generator
+	expect("RNG");
+	in >> Math::randEngine();
+
+	// temperature schedule
+	expect("temp_schedule");
+	in >> count;
+	fp.tempSchedule.clear();
+	fp.tempSchedule.reserve(count);
+	for (unsigned s = 0; s < count; s++) {
+		FloorPlanner::TempStep step;
+
+		in >> step.step;
+		readDouble(step.temp);
+		readDouble(step.avg_cost);
+		in >> step.new_best_sol_found;
+		readDouble(step.cost_best_sol);
+		in >> step.inner_loop_max;
+		readDouble(step.accepted_ops_ratio);
+
+		fp.tempSchedule.push_back(std::move(step));
+	}
+
+	// terminal pins; also set upper right to same coordinates, thus pins are
+	// ``point'' blocks w/ zero area
+	expect("terminals");
+	in >> count;
+	if (count != fp.terminals.size()) {
+		std::cout << "IO> Checkpoint contains " << count << " terminal pins; read in benchmark contains " << fp.terminals.size() << " pins!" << std::endl;
+		exit(1);
+	}
+	for (Pin& pin : fp.terminals) {
+		readDouble(pin.bb.ll.x);
+		readDouble(pin.bb.ll.y);
+		pin.bb.ur.x = pin.bb.ll.x;
+		pin.bb.ur.y = pin.bb.ll.y;
+	}
+
+	// block shapes
+	expect("shapes");
+	in >> count;
+	for (unsigned b = 0; b < count; b++) {
+
+		in >> tmpstr;
+		Block const* block = findBlock(tmpstr);
+
+		for (Rect* bb : {&block->bb, &block->bb_best}) {
+			readDouble(bb->ll.x);
+			readDouble(bb->ll.y);
+			readDouble(bb->ur.x);
+			readDouble(bb->ur.y);
+			readDouble(bb->w);
+			readDouble(bb->h);
+		}
+
+		// the area is fixed, but has to be initialized for the best-solution
+		// shape as well, since CorblivarCore::storeBestCBLs was not called yet
+		block->bb_best.area = block->bb.area;
+	}
+
+	// current and best CBLs
+	for (int d = 0; d < fp.IC.layers; d++) {
+
+		for (CornerBlockList* CBL : {&corb.editDie(d).CBL, &corb.editDie(d).CBLbest}) {
+
+			expect(CBL == &corb.getDie(d).CBL ? "CBL" : "CBL_best");
+			// drop die id
+			in >> tmpstr;
+			in >> count;
+
+			CBL->clear();
+
+			for (unsigned t = 0; t < count; t++) {
+				CornerBlockList::Tuple tuple;
+				unsigned dir;
+
+				in >> tmpstr;
+				tuple.S = findBlock(tmpstr);
+				in >> dir;
+				tuple.L = static_cast<Direction>(dir);
+				in >> tuple.T;
+
+				// memorize layer in block itself; only for current CBLs
+				if (CBL == &corb.getDie(d).CBL) {
+					tuple.S->layer = d;
+				}
+
+				CBL->insert(std::move(tuple));
+			}
+		}
+	}
+
+	expect("checkpoint_end");
+	in.close();
+
+	if (fp.logMed()) {
+		std::cout << "IO> ";
+		std::cout << "Done; resume w/ SA step " << state.step << std::endl << std::endl;
+	}
+}
+
+/// names resemble the string ids which were previously assigned for each island during
+/// layout evaluation
+std::string IO::TSVIslandName(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignments, TSV_Island const& island) {
+
+	switch (island.type) {
+
+		case TSV_Island::Type::NET:
+			return "net_" + fp.nets[island.id].id + "_" + std::to_string(island.layer);
+
+		case TSV_Island::Type::BUS:
+			for (CorblivarAlignmentReq const& req : alignments) {
+				if (req.id == island.id) {
+					return "bus_" + req.s_i->id + "_" + req.s_j->id;
+				}
+			}
+			return "bus_" + std::to_string(island.id);
+
+		case TSV_Island::Type::CLUSTER:
+			return "net_cluster_" + std::to_string(island.TSVs_count);
+
+		default:
+			return "dummy_" + std::to_string(island.id) + "_" + std::to_string(island.layer);
+	}
+}
+
 /// generate gnuplot for floorplans
 void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignment, std::string const& benchmark_suffix) {
 	std::ofstream gp_out;
@@ -2953,7 +3946,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 		out_name << fp.benchmark << benchmark_suffix << "_" << cur_layer + 1 << ".gp";
 
 		// init file stream
-		gp_out.open(out_name.str().c_str());
+		gp_out.open((fp.IO_conf.output_dir + out_name.str()).c_str());
 
 		// file header
 		gp_out << "set title \"Floorplan - " << fp.benchmark << ", Layer " << cur_layer + 1 << "\" noenhanced" << std::endl;
@@ -3118,7 +4111,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignment
 
 			// label, only for larger islands not for single TSVs
 			if (TSV_group.TSVs_count > 1) {
-				gp_out << "set label \"" << TSV_group.id << "\"";
+				gp_out << "set label \"" << IO::TSVIslandName(fp, alignment, TSV_group) << "\"";
 				gp_out << " at " << TSV_group.bb.ll.x + 0.01 * fp.IC.outline_x;
 				gp_out << "," << TSV_group.bb.ll.y + 0.01 * fp.IC.outline_y;
 				gp_out << " font \"Gill Sans,2\"";
@@ -3550,7 +4543,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		fp_file << fp.benchmark << benchmark_suffix << "_HotSpot_Si_active_" << cur_layer + 1 << ".flp";
 
 		// init file stream
-		file.open(fp_file.str().c_str());
+		file.open((fp.IO_conf.output_dir + fp_file.str()).c_str());
 
 		// file header
 		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
@@ -3600,8 +4593,8 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		bond_fp_file << fp.benchmark << benchmark_suffix << "_HotSpot_bond_" << cur_layer + 1 << ".flp";
 
 		// init file streams
-		file.open(Si_fp_file.str().c_str());
-		file_bond.open(bond_fp_file.str().c_str());
+		file.open((fp.IO_conf.output_dir + Si_fp_file.str()).c_str());
+		file_bond.open((fp.IO_conf.output_dir + bond_fp_file.str()).c_str());
 
 		// file headers
 		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
@@ -3735,7 +4728,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 		BEOL_fp_file << fp.benchmark << benchmark_suffix << "_HotSpot_BEOL_" << cur_layer + 1 << ".flp";
 
 		// init file stream
-		file.open(BEOL_fp_file.str().c_str());
+		file.open((fp.IO_conf.output_dir + BEOL_fp_file.str()).c_str());
 
 		// file header
 		file << "# Line Format: <unit-name>\\t<width>\\t<height>\\t<left-x>\\t<bottom-y>\\t<specific-heat>\\t<resistivity>" << std::endl;
@@ -3783,7 +4776,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 	power_file << fp.benchmark << benchmark_suffix << "_HotSpot.ptrace";
 
 	// init file stream
-	file.open(power_file.str().c_str());
+	file.open((fp.IO_conf.output_dir + power_file.str()).c_str());
 
 	// block sequence in trace file has to follow layer files, thus build up file
 	// according to layer structure
@@ -3861,7 +4854,7 @@ void IO::writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_
 	stack_file << fp.benchmark << benchmark_suffix << "_HotSpot.lcf";
 
 	// init file stream
-	file.open(stack_file.str().c_str());
+	file.open((fp.IO_conf.output_dir + stack_file.str()).c_str());
 
 	// file header
 	file << "#Lines starting with # are used for commenting" << std::endl;
@@ -31,6 +31,7 @@
 class FloorPlanner;
 class CorblivarCore;
 class CorblivarAlignmentReq;
+class TSV_Island;
 
 // boost namespaces
 //
@@ -49,6 +50,15 @@ class IO {
 	private:
 		static constexpr int CONFIG_VERSION = 23;
 		static constexpr int TECHNOLOGY_VERSION = 7;
+		static constexpr int CHECKPOINT_VERSION = 2;
+
+		/// warm start; relative tolerance for blocks area, beyond which the
+		/// block dimensions from the solution file are not applied as is
+		static constexpr double WARM_START_AREA_TOLERANCE = 1.0e-3;
+
+		/// name of TSV island, derived from its type and id; only required for
+		/// output files
+		static std::string TSVIslandName(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignments, TSV_Island const& island);
 
 	// constructors, destructors, if any non-implicit
 	private:
@@ -60,16 +70,27 @@ class IO {
 	public:
 		enum MAPS_FLAGS : int {POWER = 0, THERMAL = 1, THERMAL_HOTSPOT = 2, TSV_DENSITY = 3, POWER_ORIG = 4, ROUTING = 5};
 
-		static void parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv);
+		static void parseParametersFiles(FloorPlanner& fp, int const& argc_all, char** argv_all);
+		static void initNamedParameters(FloorPlanner& fp);
+		static void parseNamedParameter(FloorPlanner& fp, std::string const& name, std::string const& value);
+		static void parseConfigFiles(FloorPlanner& fp, std::string const& config_file, double const& TSV_density, int const& log_override = -1);
 		static void parseBlocks(FloorPlanner& fp);
+		static void parseBlocks(FloorPlanner& fp, std::istream& blocks_in, std::istream& pins_in, std::istream& power_in);
 		static void parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments);
+		static void parseAlignmentRequests(FloorPlanner& fp, std::vector<CorblivarAlignmentReq>& alignments, std::istream& al_in);
 		static void parseNets(FloorPlanner& fp);
+		static void parseNets(FloorPlanner& fp, std::istream& in);
 		static void parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb);
+		static void parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb, std::istream& solution_in);
 		static void writeFloorplanGP(FloorPlanner const& fp, std::vector<CorblivarAlignmentReq> const& alignment, std::string const& benchmark_suffix = "");
 		static void writeHotSpotFiles(FloorPlanner const& fp, std::string const& benchmark_suffix = "");
 		/// non-const reference due to map acces via []
 		static void writeMaps(FloorPlanner& fp, int const& flag_parameter = -1, std::string const& benchmark_suffix = "");
 		static void writeTempSchedule(FloorPlanner const& fp);
+		static void writeParetoArchive(FloorPlanner const& fp);
+		static void writeReport(FloorPlanner const& fp, bool const& overall_cost);
+		static void writeCheckpoint(FloorPlanner const& fp, CorblivarCore const& corb);
+		static void parseCheckpoint(FloorPlanner& fp, CorblivarCore& corb);
 };
 
 #endif
@@ -104,7 +104,7 @@ bool LayoutOperations::performLayoutOp(CorblivarCore& corb, int const& layout_fi
 				this->prepareHandlingOutlineCriticalBlock(corb, die1, tuple1);
 
 				// perform any random operation on that block
-				this->last_op = op = Math::randI(1, 6);
+				this->last_op = op = this->selectOp(SA_phase_two);
 			}
 		}
 
@@ -120,9 +120,7 @@ bool LayoutOperations::performLayoutOp(CorblivarCore& corb, int const& layout_fi
 				this->preselectBlockFromLargestNet(corb, die1, tuple1);
 			}
 
-			// see defined op-codes to set random-number ranges; recall that
-			// randI(x,y) is [x,y)
-			this->last_op = op = Math::randI(1, 6);
+			this->last_op = op = this->selectOp(SA_phase_two);
 		}
 	}
 
@@ -188,6 +186,110 @@ bool LayoutOperations::performLayoutOp(CorblivarCore& corb, int const& layout_fi
 	return ret;
 }
 
+int LayoutOperations::selectOp(bool const& SA_phase_two) const {
+	std::array<double, LayoutOperations::OP_REGULAR_COUNT> weights;
+	double weights_sum, p, r;
+	int op;
+
+	// regular, uniform selection; see defined op-codes to set random-number ranges;
+	// recall that randI(x,y) is [x,y)
+	if (!this->parameters.adaptive_op_selection) {
+		return Math::randI(1, 6);
+	}
+
+	// adaptive selection; weight each op by its quality estimate, i.e., by the
+	// expected cost improvement per evaluation; note that the runtime is not
+	// considered, since each op requires one full layout evaluation anyway, and
+	// since measured runtimes would render seeded runs irreproducible
+	weights_sum = 0.0;
+	for (op = 0; op < LayoutOperations::OP_REGULAR_COUNT; op++) {
+
+		weights[op] = this->op_stats[SA_phase_two][op].quality;
+		weights_sum += weights[op];
+	}
+
+	// probability matching; each op retains a min probability such that the
+	// quality estimates remain up-to-date; uniform selection as long as no op has
+	// improved the cost yet
+	r = Math::randF(0, 1);
+	for (op = 0; op < LayoutOperations::OP_REGULAR_COUNT - 1; op++) {
+
+		if (weights_sum > 0.0) {
+			p = LayoutOperations::OP_PROBABILITY_MIN +
+				(1.0 - LayoutOperations::OP_REGULAR_COUNT * LayoutOperations::OP_PROBABILITY_MIN) * weights[op] / weights_sum;
+		}
+		else {
+			p = 1.0 / LayoutOperations::OP_REGULAR_COUNT;
+		}
+
+		if (r < p) {
+			break;
+		}
+
+		r -= p;
+	}
+
+	// op-codes are one-based
+	return op + 1;
+}
+
+void LayoutOperations::updateOpStats(bool const& SA_phase_two, double const& prev_cost, double const& cost_diff, bool const& accepted, double const& runtime) {
+	this->updateOpStats(this->last_op, SA_phase_two, prev_cost, cost_diff, accepted, runtime);
+}
+
+void LayoutOperations::updateOpStats(int const& op, bool const& SA_phase_two, double const& prev_cost, double const& cost_diff, bool const& accepted, double const& runtime) {
+	double reward;
+
+	// consider only regular ops
+	if (op < LayoutOperations::OP_SWAP_BLOCKS || op > LayoutOperations::OP_ROTATE_BLOCK__SHAPE_BLOCK) {
+		return;
+	}
+
+	OpStats& stats = this->op_stats[SA_phase_two][op - 1];
+
+	stats.evaluated++;
+	stats.runtime += runtime;
+	if (accepted) {
+		stats.accepted++;
+	}
+
+	// reward only cost improvements, relative to previous cost such that the
+	// reward is independent of the cost scale, which differs for SA phase one and
+	// two
+	reward = 0.0;
+	if (cost_diff < 0.0) {
+		stats.improvement -= cost_diff;
+		reward = -cost_diff / (std::abs(prev_cost) + Math::epsilon);
+	}
+
+	stats.quality += LayoutOperations::OP_QUALITY_LEARNING_RATE * (reward - stats.quality);
+}
+
+void LayoutOperations::logOpStats() const {
+	static constexpr const char* op_names[LayoutOperations::OP_REGULAR_COUNT] = {"swap blocks", "move tuple", "switch insertion dir", "switch tuple juncts", "rotate/shape block"};
+
+	for (unsigned phase = 0; phase < this->op_stats.size(); phase++) {
+
+		std::cout << "SA> Layout-operation statistics, SA phase " << phase + 1 << ":" << std::endl;
+
+		for (int op = 0; op < LayoutOperations::OP_REGULAR_COUNT; op++) {
+
+			OpStats const& stats = this->op_stats[phase][op];
+
+			std::cout << "SA>  " << op_names[op] << ": evaluated: " << stats.evaluated;
+
+			if (stats.evaluated > 0) {
+				std::cout << ", accept ratio: " << static_cast<double>(stats.accepted) / stats.evaluated;
+				std::cout << ", avg cost improvement: " << stats.improvement / stats.evaluated;
+				std::cout << ", avg runtime [us]: " << 1.0e6 * stats.runtime / stats.evaluated;
+				std::cout << ", quality: " << stats.quality;
+			}
+
+			std::cout << std::endl;
+		}
+	}
+}
+
 void LayoutOperations::prepareHandlingOutlineCriticalBlock(CorblivarCore const& corb, int& die1, int& tuple1) const {
 	int random_tuple;
 
@@ -567,6 +669,9 @@ bool LayoutOperations::prepareBlockSwappingFailedAlignment(CorblivarCore const&
 	}
 }
 
+/// note that the nearest fronts are determined by linear scans over the die's blocks; a
+/// sorted-edge index would have to be rebuilt for each generated layout, i.e., for each
+/// operation, which is more expensive than the single scan required per operation
 bool LayoutOperations::performOpEnhancedSoftBlockShaping(CorblivarCore const& corb, Block const* shape_block) const {
 	int op;
 	double boundary_x, boundary_y;
@@ -675,6 +780,8 @@ bool LayoutOperations::performOpEnhancedSoftBlockShaping(CorblivarCore const& co
 	}
 }
 
+/// note that the row/column is determined by a linear scan over the die's blocks, for the
+/// same reason as in performOpEnhancedSoftBlockShaping
 bool LayoutOperations::performOpEnhancedHardBlockRotation(CorblivarCore const& corb, Block const* shape_block) const {
 	double col_max_width, row_max_height;
 	double gain, loss;
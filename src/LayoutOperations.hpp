@@ -40,6 +40,17 @@ class LayoutOperations {
 
 	// constructors, destructors, if any non-implicit
 	public:
+		/// default constructor
+		LayoutOperations() {
+
+			// init statistics for adaptive operation selection
+			for (auto& phase_stats : this->op_stats) {
+				for (OpStats& stats : phase_stats) {
+					stats.evaluated = stats.accepted = 0;
+					stats.improvement = stats.runtime = stats.quality = 0.0;
+				}
+			}
+		}
 
 	// public data, functions
 	public:
@@ -73,6 +84,19 @@ class LayoutOperations {
 			/// layout generation options; parsed in IO::parseParametersFiles
 			int packing_iterations;
 
+			/// adaptive operation selection; parsed from optional
+			/// command-line parameters in IO::parseParametersFiles
+			bool adaptive_op_selection;
+
+			/// initial die assignment of blocks by min-cut partitioning;
+			/// parsed from optional command-line parameters in
+			/// IO::parseParametersFiles
+			bool partitioning_init;
+			/// initial order and insertion directions of CBL tuples by
+			/// analytical placement; parsed from optional command-line
+			/// parameters in IO::parseParametersFiles
+			bool placement_init;
+
 			/// block-selection guidance; the currently largest individual net;
 			/// this net and the related modules are of particular interest to
 			/// be rearranged; this parameter is updated during
@@ -80,6 +104,41 @@ class LayoutOperations {
 			Net const* largest_net = nullptr;
 		} parameters;
 
+		/// adaptive operation selection; number of regular op-codes, i.e.,
+		/// OP_SWAP_BLOCKS to OP_ROTATE_BLOCK__SHAPE_BLOCK
+		static constexpr int OP_REGULAR_COUNT = 5;
+
+		/// adaptive operation selection; statistics for each regular op-code,
+		/// separately for SA phase one and two; POD declaration
+		struct OpStats {
+			/// evaluated and accepted ops
+			unsigned long evaluated, accepted;
+			/// sum of cost improvements, i.e., of negative cost differences
+			double improvement;
+			/// sum of runtime [s] for layout generation and evaluation
+			double runtime;
+			/// quality estimate; recency-weighted avg of relative cost
+			/// improvements
+			double quality;
+		};
+		/// adaptive operation selection; statistics, indexed by SA phase
+		/// (zero-based) and op-code (zero-based)
+		std::array<std::array<OpStats, OP_REGULAR_COUNT>, 2> op_stats;
+
+		/// adaptive operation selection; update statistics for the last op,
+		/// given its evaluation; may be called after reverting the op, since
+		/// reverting retains the op-code of the last op
+		void updateOpStats(bool const& SA_phase_two, double const& prev_cost, double const& cost_diff, bool const& accepted, double const& runtime);
+		/// adaptive operation selection; update statistics for the given op,
+		/// e.g., for ops evaluated on another instance
+		void updateOpStats(int const& op, bool const& SA_phase_two, double const& prev_cost, double const& cost_diff, bool const& accepted, double const& runtime);
+		/// getter; op-code of last op
+		inline int const& lastOp() const {
+			return this->last_op;
+		};
+		/// adaptive operation selection; log statistics
+		void logOpStats() const;
+
 	// private data, functions
 	private:
 		/// layout operations op-codes
@@ -113,6 +172,16 @@ class LayoutOperations {
 		/// layout operations op-codes
 		static constexpr int OP_SWAP_ALIGNMENT_COORDINATES = 21;
 
+		/// adaptive operation selection; learning rate for quality estimates
+		static constexpr double OP_QUALITY_LEARNING_RATE = 0.01;
+		/// adaptive operation selection; min selection probability for each
+		/// op-code, such that all ops remain explored
+		static constexpr double OP_PROBABILITY_MIN = 0.1;
+
+		/// layout-operation handler; select regular op-code, either uniformly
+		/// or w.r.t. statistics
+		int selectOp(bool const& SA_phase_two) const;
+
 		/// layout-operation handler variables
 		mutable int last_op, last_op_die1, last_op_die2, last_op_tuple1, last_op_tuple2, last_op_juncts;
 		/// layout-operation handler
@@ -48,6 +48,21 @@ class Math {
 		/// division by zero
 		static constexpr double epsilon = 1.0e-10;
 
+		/// random-number engine; the state is accessible via the stream operators
+		/// of std::mt19937, e.g., for SA checkpoints, see IO::writeCheckpoint
+		///
+		/// note that the function-local static is shared across all translation
+		/// units, but separate for each thread; worker threads have to seed their
+		/// engine themselves, see FloorPlanner::evaluateCandidateMove
+		inline static std::mt19937& randEngine() {
+			static thread_local std::mt19937 engine;
+			return engine;
+		};
+		/// seed random-number engine
+		inline static void seed(unsigned const& seed) {
+			randEngine().seed(seed);
+		};
+
 		/// random-number functions
 		/// note: range is [min, max)
 		inline static int randI(int const& min, int const& max) {
@@ -55,18 +70,17 @@ class Math {
 				return min;
 			}
 			else {
-				return min + (rand() % (max - min));
+				return min + static_cast<int>(randEngine()() % static_cast<unsigned>(max - min));
 			}
 		};
 		/// random decision
 		inline static bool randB() {
-			int const r = rand();
-			return (r < (RAND_MAX / 2));
+			return (randEngine()() < (std::mt19937::max() / 2));
 		};
 		/// random-number functions
 		/// note: range is [min, max)
 		inline static double randF(double const& min, double const& max) {
-			double const r = static_cast<double>(rand()) / RAND_MAX;
+			double const r = static_cast<double>(randEngine()()) / std::mt19937::max();
 			return r * (max - min) + min;
 		};
 
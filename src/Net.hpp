@@ -133,7 +133,7 @@ class Net {
 					TSV_in_layer = true;
 
 					if (Net::DBG) {
-						std::cout << "DBG_NET> 	Consider TSV island " << t.id << " on layer " << layer << std::endl;
+						std::cout << "DBG_NET> 	Consider TSV island " << t.type << " " << t.id << " on layer " << layer << std::endl;
 					}
 				}
 			}
@@ -199,7 +199,7 @@ class Net {
 						blocks_to_consider.push_back(&t.bb);
 
 						if (Net::DBG) {
-							std::cout << "DBG_NET> 	Consider TSV island " << t.id << " on layer " << layer - 1 << std::endl;
+							std::cout << "DBG_NET> 	Consider TSV island " << t.type << " " << t.id << " on layer " << layer - 1 << std::endl;
 						}
 					}
 				}
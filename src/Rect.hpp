@@ -182,7 +182,7 @@ class Rect {
 		/// back and forth; thus, greedy shifting has to follow a strict shifting
 		/// direction, i.e., upwards
 		///
-		inline static void greedyShiftingRemoveIntersection(Rect& to_shift, Rect& fixed) {
+		inline static void greedyShiftingRemoveIntersection(Rect& to_shift, Rect const& fixed) {
 			Rect intersect;
 
 			intersect = Rect::determineIntersection(to_shift, fixed);
@@ -236,6 +236,12 @@ class Rect {
 		inline static bool rectA_below_rectB(Rect const& a, Rect const& b, bool const& considerHorizontalIntersect) {
 			return (a.ur.y <= b.ll.y) && (!considerHorizontalIntersect || rectsIntersectHorizontal(a, b));
 		};
+
+		/// helper to check whether two rectangles are exactly the same, i.e., same
+		/// position and dimensions
+		inline static bool identical(Rect const& a, Rect const& b) {
+			return (a.ll.x == b.ll.x && a.ll.y == b.ll.y && a.ur.x == b.ur.x && a.ur.y == b.ur.y && a.w == b.w && a.h == b.h);
+		};
 };
 
 #endif
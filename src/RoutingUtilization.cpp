@@ -46,25 +46,35 @@ void RoutingUtilization::resetUtilMaps(int const& layers) {
 }
 
 void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outline) {
-	unsigned b;
-	int i;
 
 	if (RoutingUtilization::DBG_CALLS) {
 		std::cout << "-> RoutingUtilization::initUtilMap()" << std::endl;
 	}
 
-	this->util_maps.clear();
-
-	// allocate util-maps arrays
-	for (i = 0; i < layers; i++) {
-		this->util_maps.emplace_back(
-			std::array<std::array<RoutingUtilization::UtilBin, RoutingUtilization::UTIL_MAPS_DIM>, RoutingUtilization::UTIL_MAPS_DIM>()
-		);
-	}
+	// allocate util-maps arrays; previously allocated arrays are kept
+	this->util_maps.resize(layers);
 
 	// init maps w/ zero values
 	this->resetUtilMaps(layers);
 
+	// scale maps to die outline
+	this->scaleUtilMaps(die_outline);
+
+	if (RoutingUtilization::DBG_CALLS) {
+		std::cout << "<- RoutingUtilization::initUtilMap" << std::endl;
+	}
+}
+
+/// re-targets the util maps to the given die outline, e.g., for shrunk dies; the maps
+/// themselves are kept as is since they are reset for each layout evaluation anyway, see
+/// resetUtilMaps
+void RoutingUtilization::scaleUtilMaps(Point const& die_outline) {
+	unsigned b;
+
+	if (RoutingUtilization::DBG_CALLS) {
+		std::cout << "-> RoutingUtilization::scaleUtilMaps()" << std::endl;
+	}
+
 	// scale of util map dimensions
 	this->util_maps_dim_x = die_outline.x / RoutingUtilization::UTIL_MAPS_DIM;
 	this->util_maps_dim_y = die_outline.y / RoutingUtilization::UTIL_MAPS_DIM;
@@ -80,7 +90,7 @@ void RoutingUtilization::initUtilMaps(int const& layers, Point const& die_outlin
 	}
 
 	if (RoutingUtilization::DBG_CALLS) {
-		std::cout << "<- RoutingUtilization::initUtilMap" << std::endl;
+		std::cout << "<- RoutingUtilization::scaleUtilMaps" << std::endl;
 	}
 }
 
@@ -81,6 +81,8 @@ class RoutingUtilization {
 		/// utilization analysis: handlers
 		void initUtilMaps(int const& layers, Point const& die_outline);
 		/// utilization analysis: handlers
+		void scaleUtilMaps(Point const& die_outline);
+		/// utilization analysis: handlers
 		void resetUtilMaps(int const& layers);
 		/// utilization analysis: handlers
 		void adaptUtilMap(int const& layer, Rect const& net_bb, double const& net_weight = 1.0);
@@ -156,7 +156,6 @@ void ThermalAnalyzer::initThermalMap(Point const& die_outline) {
 }
 
 void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline) {
-	unsigned b;
 	int i;
 	ThermalAnalyzer::PowerMapBin init_bin;
 
@@ -164,18 +163,9 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 		std::cout << "-> ThermalAnalyzer::initPowerMaps(" << layers << ", " << die_outline.x << ", " << die_outline.y << ")" << std::endl;
 	}
 
-	this->power_maps.clear();
-	this->power_maps_orig.clear();
-
-	// allocate power-maps arrays
-	for (i = 0; i < layers; i++) {
-		this->power_maps.emplace_back(
-			std::array<std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM>()
-		);
-		this->power_maps_orig.emplace_back(
-			std::array<std::array<ThermalAnalyzer::PowerMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM>()
-		);
-	}
+	// allocate power-maps arrays; previously allocated arrays are kept
+	this->power_maps.resize(layers);
+	this->power_maps_orig.resize(layers);
 
 	// init the maps w/ zero values
 	init_bin.power_density = init_bin.TSV_density = 0.0;
@@ -188,6 +178,25 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 		}
 	}
 
+	// scale maps to die outline
+	this->scalePowerMaps(die_outline);
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "<- ThermalAnalyzer::initPowerMaps" << std::endl;
+	}
+}
+
+/// re-targets the power maps to the given die outline, e.g., for shrunk dies; the maps
+/// themselves are kept as is since they are re-generated for each layout evaluation anyway,
+/// see generatePowerMaps; the thermal masks are independent of the bins' dimensions and
+/// thus also kept
+void ThermalAnalyzer::scalePowerMaps(Point const& die_outline) {
+	unsigned b;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		std::cout << "-> ThermalAnalyzer::scalePowerMaps(" << die_outline.x << ", " << die_outline.y << ")" << std::endl;
+	}
+
 	// scale power map dimensions to outline of thermal map; this way the padding of
 	// power maps doesn't distort the block outlines in the thermal map
 	this->power_maps_dim_x = die_outline.x / ThermalAnalyzer::THERMAL_MAP_DIM;
@@ -213,7 +222,7 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 	}
 
 	if (ThermalAnalyzer::DBG_CALLS) {
-		std::cout << "<- ThermalAnalyzer::initPowerMaps" << std::endl;
+		std::cout << "<- ThermalAnalyzer::scalePowerMaps" << std::endl;
 	}
 }
 
@@ -474,7 +483,7 @@ void ThermalAnalyzer::generatePowerMaps(int const& layers, std::vector<Block> co
 /// local power consumption, not the (much smaller) increase of power consumption due to
 /// resistivity of TSVs; TSVs densities, required for HotSpot calculation, are also
 /// adapted here
-void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Island> TSVs, std::vector<TSV_Island> dummy_TSVs, MaskParameters const& parameters) {
+void ThermalAnalyzer::adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Island> const& TSVs, std::vector<TSV_Island> const& dummy_TSVs, MaskParameters const& parameters) {
 	unsigned x, y;
 	int i;
 
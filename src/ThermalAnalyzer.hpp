@@ -247,9 +247,11 @@ class ThermalAnalyzer {
 		/// thermal modeling: handlers
 		void initPowerMaps(int const& layers, Point const& die_outline);
 		/// thermal modeling: handlers
+		void scalePowerMaps(Point const& die_outline);
+		/// thermal modeling: handlers
 		void generatePowerMaps(int const& layers, std::vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone = true);
 		/// thermal modeling: handlers
-		void adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Island> TSVs, std::vector<TSV_Island> dummy_TSVs, MaskParameters const& parameters);
+		void adaptPowerMapsTSVs(int const& layers, std::vector<TSV_Island> const& TSVs, std::vector<TSV_Island> const& dummy_TSVs, MaskParameters const& parameters);
 		void adaptPowerMapsTSVsHelper(TSV_Island TSVi);
 		/// thermal modeling: handlers
 		void adaptPowerMapsWires(std::vector<Block>& wires);
@@ -258,6 +260,11 @@ class ThermalAnalyzer {
 		/// i.e., convolution of thermals masks and power maps
 		void performPowerBlurring(ThermalAnalysisResult& ret, int const& layers, MaskParameters const& parameters);
 
+		/// getter
+		inline std::vector< std::array<double, THERMAL_MASK_DIM> > const& getThermalMasks() const {
+			return this->thermal_masks;
+		};
+
 		/// getter
 		inline std::vector< std::array< std::array<PowerMapBin, THERMAL_MAP_DIM>, THERMAL_MAP_DIM> > const& getPowerMapsOrig() const {
 			return this->power_maps_orig;
@@ -0,0 +1,369 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Batch job driver; runs many benchmark/config pairs in one process,
+ *    scheduled over a pool of worker threads
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+#include <atomic>
+#include <cstdio>
+
+/// batch job driver; friend of FloorPlanner in order to replicate parsed configurations
+/// across jobs and to access the final results
+class Batch {
+	public:
+		/// one job, i.e., one regular Corblivar run
+		struct Job {
+			std::string benchmark, config_file, benchmarks_dir, output_dir;
+			unsigned seed;
+			/// further named parameters, as ``--name value'' pairs
+			std::vector<std::string> options;
+			/// line in jobs file
+			unsigned line;
+			/// floorplanner, holding the parsed configuration; blocks, nets
+			/// etc. are parsed by the job itself, as they are altered during
+			/// SA
+			std::unique_ptr<FloorPlanner> fp;
+			/// outcome of run
+			bool done, success;
+		};
+
+	private:
+		/// named parameters which are not supported per job; they are either
+		/// covered by the jobs file or refer to further files, which would
+		/// be shared by all jobs
+		static bool unsupportedOption(std::string const& option) {
+			return (option == "--seed" || option == "--output-dir" || option == "--warm-start" ||
+					option == "--telemetry" || option == "--checkpoint" || option == "--resume");
+		}
+
+		/// setup key; jobs w/ the same setup differ only by seed and output
+		/// directory, thus they can share the parsed configuration
+		static std::string setupKey(Job const& job) {
+			std::stringstream key;
+
+			key << job.benchmark << " " << job.config_file << " " << job.benchmarks_dir;
+			for (std::string const& option : job.options) {
+				key << " " << option;
+			}
+
+			return key.str();
+		}
+
+		/// synchronization of progress logging
+		static std::mutex log_mutex;
+
+	public:
+		/// parse jobs file; one job per line: benchmark_name config_file
+		/// benchmarks_dir seed output_dir [--name value ...]
+		static void parseJobs(std::string const& jobs_file, std::vector<Job>& jobs) {
+			std::ifstream in;
+			std::string line, tmpstr;
+			std::set<std::string> outputs;
+			unsigned line_count;
+
+			in.open(jobs_file.c_str());
+			if (!in.good()) {
+				std::cout << "Batch> No such jobs file: " << jobs_file << std::endl;
+				exit(1);
+			}
+
+			line_count = 0;
+			while (std::getline(in, line)) {
+				std::stringstream tokens(line);
+				Job job;
+
+				line_count++;
+
+				// skip empty lines and comments
+				if (!(tokens >> tmpstr) || tmpstr[0] == '#') {
+					continue;
+				}
+
+				job.benchmark = tmpstr;
+				job.line = line_count;
+				job.done = job.success = false;
+
+				if (!(tokens >> job.config_file >> job.benchmarks_dir >> tmpstr >> job.output_dir)) {
+					std::cout << "Batch> Incomplete job in line " << line_count << " of " << jobs_file << std::endl;
+					exit(1);
+				}
+				job.seed = std::stoul(tmpstr);
+
+				// all output files are named by concatenation
+				if (job.output_dir.back() != '/') {
+					job.output_dir += "/";
+				}
+
+				// jobs must not overwrite each others' output files
+				if (!outputs.insert(job.output_dir + job.benchmark).second) {
+					std::cout << "Batch> Output files of job in line " << line_count << " would overwrite those of a previous job; consider another output dir" << std::endl;
+					exit(1);
+				}
+
+				while (tokens >> tmpstr) {
+
+					if (tmpstr.size() <= 2 || tmpstr.compare(0, 2, "--") != 0) {
+						std::cout << "Batch> Only named parameters may follow the output dir, see line " << line_count << ": " << tmpstr << std::endl;
+						exit(1);
+					}
+					if (Batch::unsupportedOption(tmpstr)) {
+						std::cout << "Batch> Named parameter not supported for batch jobs, see line " << line_count << ": " << tmpstr << std::endl;
+						exit(1);
+					}
+
+					job.options.push_back(tmpstr);
+
+					if (!(tokens >> tmpstr)) {
+						std::cout << "Batch> Value missing for named parameter, see line " << line_count << ": " << job.options.back() << std::endl;
+						exit(1);
+					}
+
+					job.options.push_back(tmpstr);
+				}
+
+				jobs.push_back(std::move(job));
+			}
+
+			in.close();
+		}
+
+		/// setup floorplanners for all jobs; the first job of each setup parses
+		/// the config and technology files, the further jobs replicate its
+		/// configuration
+		static void setupJobs(std::vector<Job>& jobs) {
+			std::map<std::string, FloorPlanner const*> setups;
+			std::map<std::string, FloorPlanner const*>::iterator iter;
+			std::vector<std::string> args;
+			std::vector<char*> argv;
+
+			for (Job& job : jobs) {
+
+				job.fp.reset(new FloorPlanner());
+				FloorPlanner& fp = *job.fp;
+
+				iter = setups.find(Batch::setupKey(job));
+
+				// new setup; parse program parameter, config file, and
+				// further files, as for regular Corblivar runs
+				if (iter == setups.end()) {
+
+					args = {"Corblivar", job.benchmark, job.config_file, job.benchmarks_dir,
+						"--seed", std::to_string(job.seed), "--output-dir", job.output_dir};
+					args.insert(args.end(), job.options.begin(), job.options.end());
+
+					argv.clear();
+					for (std::string& arg : args) {
+						argv.push_back(&arg[0]);
+					}
+
+					IO::parseParametersFiles(fp, argv.size(), argv.data());
+
+					setups.insert({Batch::setupKey(job), &fp});
+
+					continue;
+				}
+
+				FloorPlanner const& setup = *iter->second;
+
+				// replicate the configuration
+				fp.replicateConfig(setup);
+				fp.schedule.seed = job.seed;
+
+				// output files of job, as opened in IO::parseParametersFiles
+				fp.IO_conf.output_dir = job.output_dir;
+				mkdir(fp.IO_conf.output_dir.c_str(), 0755);
+
+				fp.IO_conf.results.open((fp.IO_conf.output_dir + fp.benchmark + ".results").c_str());
+				if (!fp.IO_conf.results.good()) {
+					std::cout << "Batch> Cannot write results file in output dir: " << fp.IO_conf.output_dir << std::endl;
+					exit(1);
+				}
+
+				fp.IO_conf.solution_file = fp.IO_conf.output_dir + fp.benchmark + ".solution";
+				fp.IO_conf.solution_out.open(fp.IO_conf.solution_file.c_str());
+			}
+		}
+
+		/// run one job; same sequence as in main() of Corblivar, for regular runs
+		static void runJob(Job& job) {
+			FloorPlanner& fp = *job.fp;
+
+			// the floorplanner was set up by the main thread; seed the
+			// random-number generator of this worker thread, and consider the
+			// runtime only from now on
+			Math::seed(fp.schedule.seed);
+			fp.time_start = std::chrono::steady_clock::now();
+
+			// parse blocks
+			IO::parseBlocks(fp);
+			// parse nets
+			IO::parseNets(fp);
+
+			// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+			fp.initTimingPowerAnalyser();
+
+			// init Corblivar core
+			CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+			// parse alignment request
+			IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+			// init thermal analyzer, only reasonable after parsing config file
+			fp.initThermalAnalyzer();
+
+			// init routing-utilization analyzer
+			fp.initRoutingUtilAnalyzer();
+
+			// generate new data set
+			fp.initCorblivar(corb);
+
+			// perform SA; main handler, covers multilevel and flat SA
+			job.success = fp.performMultilevelSA(corb);
+
+			// finalize: generate output files, final logging
+			fp.finalize(corb);
+
+			job.done = true;
+		}
+
+		/// run all jobs, scheduled over the given count of worker threads in
+		/// order of the jobs file
+		static void runJobs(std::vector<Job>& jobs, unsigned const& workers) {
+			std::vector<std::thread> threads;
+			std::atomic<unsigned> next_job(0);
+			unsigned done_jobs = 0;
+
+			for (unsigned w = 0; w < workers; w++) {
+
+				threads.emplace_back([&]() {
+					unsigned j;
+
+					while ((j = next_job++) < jobs.size()) {
+
+						Batch::runJob(jobs[j]);
+
+						std::lock_guard<std::mutex> lock(Batch::log_mutex);
+
+						done_jobs++;
+						std::cerr << "Batch> Done " << done_jobs << "/" << jobs.size() << ": job in line " << jobs[j].line;
+						std::cerr << ", " << jobs[j].benchmark << ", seed " << jobs[j].seed << ", runtime [s]: " << jobs[j].fp->SA_stats.runtime << std::endl;
+					}
+				});
+			}
+
+			for (std::thread& thread : threads) {
+				thread.join();
+			}
+		}
+
+		/// write summary table, one line per job
+		static void writeSummary(std::vector<Job> const& jobs, std::string const& summary_file) {
+			std::ofstream out;
+
+			out.open(summary_file.c_str());
+
+			out << "# Corblivar batch summary; actual values of final solutions, - for jobs w/o solution fitting into the outline" << std::endl;
+			out << "# line benchmark config_file seed output_dir valid cost deadspace HPWL TSVs runtime" << std::endl;
+
+			for (Job const& job : jobs) {
+				FloorPlanner const& fp = *job.fp;
+
+				out << job.line << " " << job.benchmark << " " << job.config_file << " " << job.seed << " " << job.output_dir;
+				out << " " << fp.SA_stats.valid_solution;
+
+				if (fp.SA_stats.valid_solution) {
+					out << " " << fp.SA_stats.cost.total_cost;
+					out << " " << 100.0 * (fp.IC.stack_deadspace / fp.IC.stack_area);
+					out << " " << fp.SA_stats.cost.HPWL_actual_value;
+					out << " " << fp.SA_stats.cost.TSVs_actual_value;
+				}
+				else {
+					out << " - - - -";
+				}
+
+				out << " " << fp.SA_stats.runtime << std::endl;
+			}
+
+			out.close();
+		}
+};
+
+std::mutex Batch::log_mutex;
+
+int main (int argc, char** argv) {
+	std::vector<Batch::Job> jobs;
+	std::string jobs_file, log_file, summary_file;
+	unsigned workers;
+
+	std::cout << std::endl;
+	std::cout << "Corblivar batch job driver" << std::endl;
+	std::cout << "--------------------------" << std::endl;
+	std::cout << std::endl;
+
+	if (argc < 2) {
+		std::cout << "Batch> Usage: " << argv[0] << " jobs_file [workers]" << std::endl;
+		std::cout << "Batch> " << std::endl;
+		std::cout << "Batch> Mandatory parameter ``jobs_file'': one job per line: benchmark_name config_file benchmarks_dir seed output_dir [--name value ...]" << std::endl;
+		std::cout << "Batch>  The named parameters are the same as for Corblivar, except for those handling further files" << std::endl;
+		std::cout << "Batch> Optional parameter ``workers'': count of jobs to be run in parallel; default: count of hardware threads" << std::endl;
+
+		exit(1);
+	}
+
+	jobs_file = argv[1];
+	log_file = jobs_file + ".log";
+	summary_file = jobs_file + ".summary";
+
+	if (argc > 2) {
+		workers = std::stoul(argv[2]);
+	}
+	else {
+		workers = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	Batch::parseJobs(jobs_file, jobs);
+	workers = std::min<unsigned>(workers, jobs.size());
+
+	std::cout << "Batch> Jobs: " << jobs.size() << "; worker threads: " << workers << std::endl;
+	std::cout << "Batch> Logging of all jobs, interleaved: " << log_file << std::endl;
+	std::cout << std::endl;
+
+	// the logging of all jobs is redirected to one file; the progress of the batch
+	// is reported via stderr
+	if (std::freopen(log_file.c_str(), "w", stdout) == nullptr) {
+		std::cerr << "Batch> Cannot write log file: " << log_file << std::endl;
+		exit(1);
+	}
+
+	Batch::setupJobs(jobs);
+	Batch::runJobs(jobs, workers);
+	Batch::writeSummary(jobs, summary_file);
+
+	std::cerr << std::endl;
+	std::cerr << "Batch> Summary: " << summary_file << std::endl;
+	std::cerr << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,325 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Micro-benchmarks for Corblivar's hot paths; reports runtime and heap
+ *    allocations per operation on a fixed-seed layout
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+#include <chrono>
+#include <functional>
+#include <new>
+
+// default parameters
+static constexpr unsigned DEFAULT_ITERATIONS = 20;
+static constexpr unsigned DEFAULT_SEED = 1;
+
+// global allocation counters; tracked via the replaced global operator new below
+static unsigned long allocs_count = 0;
+static unsigned long allocs_bytes = 0;
+
+void* operator new(std::size_t size) {
+	void* p;
+
+	allocs_count++;
+	allocs_bytes += size;
+
+	p = std::malloc(size == 0 ? 1 : size);
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return p;
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	std::free(p);
+}
+
+/// micro-benchmark driver; friend of FloorPlanner in order to access the evaluation
+/// routines and analyzers directly
+class Benchmark {
+	private:
+		/// POD for benchmark results
+		struct Result {
+			std::string op;
+			unsigned iterations;
+			double ns_per_op;
+			double allocs_per_op;
+			double bytes_per_op;
+		};
+
+		/// benchmark helper; setup is performed before each iteration but not
+		/// considered for the measurements
+		static Result measure(std::string const& op, unsigned const& iterations, std::function<void()> setup, std::function<void()> run) {
+			Result ret;
+			std::chrono::steady_clock::time_point start;
+			std::chrono::nanoseconds elapsed(0);
+			unsigned long allocs_count_start, allocs_bytes_start;
+			unsigned long allocs_count_total, allocs_bytes_total;
+
+			// warm-up run, not measured
+			setup();
+			run();
+
+			allocs_count_total = allocs_bytes_total = 0;
+
+			for (unsigned i = 0; i < iterations; i++) {
+
+				setup();
+
+				allocs_count_start = allocs_count;
+				allocs_bytes_start = allocs_bytes;
+				start = std::chrono::steady_clock::now();
+
+				run();
+
+				elapsed += std::chrono::steady_clock::now() - start;
+				allocs_count_total += allocs_count - allocs_count_start;
+				allocs_bytes_total += allocs_bytes - allocs_bytes_start;
+			}
+
+			ret.op = op;
+			ret.iterations = iterations;
+			ret.ns_per_op = static_cast<double>(elapsed.count()) / iterations;
+			ret.allocs_per_op = static_cast<double>(allocs_count_total) / iterations;
+			ret.bytes_per_op = static_cast<double>(allocs_bytes_total) / iterations;
+
+			return ret;
+		};
+
+		/// net segments for clustering, to be derived similar to
+		/// FloorPlanner::evaluateInterconnects
+		static void determNetsSegments(FloorPlanner& fp, std::vector< std::vector<Clustering::Segments> >& nets_segments) {
+			Rect bb, prev_bb;
+
+			nets_segments.clear();
+			for (int i = 0; i < fp.IC.layers; i++) {
+				nets_segments.emplace_back(std::vector<Clustering::Segments>());
+			}
+
+			for (Net& cur_net : fp.nets) {
+
+				cur_net.TSVs.clear();
+				cur_net.resetLayerBoundaries();
+
+				for (int i = cur_net.layer_bottom; i < cur_net.layer_top; i++) {
+
+					bb = cur_net.determBoundingBox(i, true);
+
+					if (bb.area == 0.0) {
+						bb = prev_bb;
+					}
+					else {
+						prev_bb = bb;
+					}
+
+					nets_segments[i].push_back({&cur_net, bb});
+				}
+			}
+		};
+
+	public:
+		/// run all micro-benchmarks on the given, already initialized floorplanner
+		static std::vector<Result> run(FloorPlanner& fp, CorblivarCore& corb, unsigned const& iterations) {
+			std::vector<Result> results;
+			FloorPlanner::Cost cost;
+			std::vector< std::vector<Clustering::Segments> > nets_segments;
+			std::vector< std::vector<Clustering::Segments> > nets_segments_orig;
+			bool const perform_alignment = fp.opt_flags.alignment;
+
+			// initial layout and full evaluation, also setting the max-cost values
+			// required for normalization; this also initializes all analyzers'
+			// internal data
+			fp.generateLayout(corb, perform_alignment);
+			fp.evaluateLayout(corb.getAlignments(), 1.0, true, true);
+
+			// also initialize the analyzers which are only triggered for
+			// particular config settings
+			fp.thermalAnalyzer.generatePowerMaps(fp.IC.layers, fp.blocks, fp.getOutline(), fp.power_blurring_parameters);
+			fp.thermalAnalyzer.performPowerBlurring(fp.thermal_analysis, fp.IC.layers, fp.power_blurring_parameters);
+			for (Block& block : fp.blocks) {
+				block.setFeasibleVoltages();
+			}
+			fp.contigAnalyser.analyseBlocks(fp.IC.layers, fp.blocks);
+			Benchmark::determNetsSegments(fp, nets_segments_orig);
+
+			results.push_back(Benchmark::measure("CorblivarCore::generateLayout", iterations,
+				[]() {},
+				[&]() {
+					corb.generateLayout(perform_alignment);
+				}
+			));
+
+			results.push_back(Benchmark::measure("CorblivarDie::performPacking", iterations,
+				[&]() {
+					corb.generateLayout(perform_alignment);
+				},
+				[&]() {
+					for (int d = 0; d < fp.IC.layers; d++) {
+						if (!corb.getDie(d).getCBL().empty()) {
+							corb.editDie(d).performPacking(Direction::HORIZONTAL);
+							corb.editDie(d).performPacking(Direction::VERTICAL);
+						}
+					}
+				}
+			));
+
+			// restore the regular layout, i.e., as evaluated initially
+			fp.generateLayout(corb, perform_alignment);
+
+			results.push_back(Benchmark::measure("FloorPlanner::evaluateAreaOutline", iterations,
+				[]() {},
+				[&]() {
+					fp.evaluateAreaOutline(cost, 1.0, true);
+				}
+			));
+
+			results.push_back(Benchmark::measure("FloorPlanner::evaluateInterconnects", iterations,
+				[]() {},
+				[&]() {
+					fp.evaluateInterconnects(cost, fp.IC.frequency, corb.getAlignments());
+				}
+			));
+
+			results.push_back(Benchmark::measure("ThermalAnalyzer::performPowerBlurring", iterations,
+				[]() {},
+				[&]() {
+					fp.thermalAnalyzer.performPowerBlurring(fp.thermal_analysis, fp.IC.layers, fp.power_blurring_parameters);
+				}
+			));
+
+			results.push_back(Benchmark::measure("TimingPowerAnalyser::updateTiming", iterations,
+				[]() {},
+				[&]() {
+					fp.timingPowerAnalyser.updateTiming(fp.opt_flags.voltage_assignment, fp.IC.delay_threshold);
+				}
+			));
+
+			results.push_back(Benchmark::measure("MultipleVoltages::determineCompoundModules", iterations,
+				[]() {},
+				[&]() {
+					fp.voltageAssignment.determineCompoundModules(fp.blocks, fp.contigAnalyser);
+				}
+			));
+
+			results.push_back(Benchmark::measure("LeakageAnalyzer::determineSpatialEntropy", iterations,
+				[]() {},
+				[&]() {
+					for (int d = 0; d < fp.IC.layers; d++) {
+						fp.leakageAnalyzer.determineSpatialEntropy(d, fp.thermalAnalyzer.getPowerMapsOrig()[d]);
+					}
+				}
+			));
+
+			results.push_back(Benchmark::measure("Clustering::clusterSignalTSVs", iterations,
+				[&]() {
+					fp.TSVs.clear();
+					fp.TSVs_index.reset(fp.getOutline());
+					for (Net& cur_net : fp.nets) {
+						cur_net.TSVs.clear();
+					}
+					nets_segments = nets_segments_orig;
+				},
+				[&]() {
+					fp.clustering.clusterSignalTSVs(fp.nets, nets_segments, fp.TSVs, fp.TSVs_index, fp.techParameters.TSV_pitch, fp.techParameters.TSV_per_cluster_limit, fp.thermal_analysis);
+				}
+			));
+
+			return results;
+		};
+
+		/// output handler
+		static void print(std::string const& benchmark, std::vector<Result> const& results) {
+
+			for (Result const& r : results) {
+				std::cout << "Benchmark> " << benchmark << " " << r.op << "; ";
+				std::cout << r.iterations << " iterations; ";
+				std::cout << std::fixed << std::setprecision(0) << r.ns_per_op << " ns/op; ";
+				std::cout << std::setprecision(1) << r.allocs_per_op << " allocs/op; ";
+				std::cout << std::setprecision(0) << r.bytes_per_op << " B/op" << std::endl;
+			}
+		};
+};
+
+int main (int argc, char** argv) {
+	FloorPlanner fp;
+	unsigned iterations, seed;
+
+	std::cout << std::endl;
+	std::cout << "Corblivar micro-benchmarks" << std::endl;
+	std::cout << "--------------------------" << std::endl;
+	std::cout << std::endl;
+
+	if (argc < 4) {
+		std::cout << "Benchmark> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [iterations] [seed]" << std::endl;
+		std::cout << "Benchmark> " << std::endl;
+		std::cout << "Benchmark> Mandatory parameters: same as for Corblivar" << std::endl;
+		std::cout << "Benchmark> Optional parameter ``iterations'': measured runs per operation; default: " << DEFAULT_ITERATIONS << std::endl;
+		std::cout << "Benchmark> Optional parameter ``seed'': seed for random layout generation; default: " << DEFAULT_SEED << std::endl;
+
+		exit(1);
+	}
+
+	iterations = (argc > 4) ? std::stoul(argv[4]) : DEFAULT_ITERATIONS;
+	seed = (argc > 5) ? std::stoul(argv[5]) : DEFAULT_SEED;
+
+	// parse program parameter, config file, and further files; consider only the
+	// mandatory parameters
+	IO::parseParametersFiles(fp, 4, argv);
+	// parse blocks
+	IO::parseBlocks(fp);
+	// parse nets
+	IO::parseNets(fp);
+
+	// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+	fp.initTimingPowerAnalyser();
+
+	// init Corblivar core
+	CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+	// parse alignment request
+	IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+	// init thermal analyzer, only reasonable after parsing config file
+	fp.initThermalAnalyzer();
+
+	// init routing-utilization analyzer
+	fp.initRoutingUtilAnalyzer();
+
+	// fixed seed, such that the same layout is benchmarked for each run
+	Math::seed(seed);
+
+	// init Corblivar data structures randomly, i.e., generate an initial layout
+	corb.initCorblivarRandomly(false, fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+
+	Benchmark::print(fp.getBenchmark(), Benchmark::run(fp, corb, iterations));
+
+	std::cout << std::endl;
+
+	return 0;
+}
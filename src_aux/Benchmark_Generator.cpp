@@ -0,0 +1,668 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Generator for synthetic GSRC-style benchmarks; emits
+ *    .blocks/.nets/.pl/.power/.alr files of controllable size and characteristics
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/Corblivar.incl.hpp"
+#include <random>
+
+/// generator for synthetic benchmarks; the files follow the GSRC formats as parsed by
+/// IO::parseBlocks, IO::parseNets and IO::parseAlignmentRequests
+class BenchmarkGenerator {
+	private:
+		/// POD for generated blocks
+		struct Block {
+			std::string id;
+			bool soft;
+			double w, h;
+			double power_density;
+		};
+
+		/// POD for generated terminals
+		struct Terminal {
+			std::string id;
+			double x, y;
+		};
+
+		/// random-number engine; seeded via parameters
+		std::mt19937 rng;
+
+		std::vector<Block> blocks;
+		std::vector<Terminal> terminals;
+		std::vector< std::vector<std::string> > nets;
+		std::vector<std::string> alignments;
+
+		/// sum of all blocks' area
+		double blocks_area;
+
+	public:
+		/// generator parameters; default values resemble the GSRC n100 benchmark
+		struct Parameters {
+			std::string name;
+			std::string dir = ".";
+
+			unsigned seed = 1;
+
+			/// blocks
+			unsigned blocks = 100;
+			/// ratio of soft blocks, [0, 1]
+			double soft_ratio = 0.0;
+			/// blocks' area range, in um^2; areas are drawn log-uniformly
+			double area_min = 1000.0, area_max = 5000.0;
+			/// blocks' aspect-ratio limit, hard blocks are drawn from [1/AR, AR];
+			/// also used as the range for soft blocks
+			double AR = 3.0;
+
+			/// terminals, i.e., fixed pins
+			unsigned terminals = 334;
+
+			/// nets
+			unsigned nets = 885;
+			/// net-degree distribution; "geometric" or "uniform"
+			std::string degree_dist = "geometric";
+			/// net degrees, average and maximal value; lower limit is 2
+			double degree_avg = 2.9;
+			unsigned degree_max = 20;
+			/// ratio of nets connecting to a terminal, [0, 1]
+			double terminal_net_ratio = 0.4;
+			/// locality of nets; blocks of one net are drawn from a window of
+			/// consecutive blocks, where the window is given as ratio of all
+			/// blocks; 1.0 means no locality
+			double locality = 0.1;
+
+			/// power-density distribution; "uniform", "normal", "lognormal"
+			/// or "bimodal"; values are given in uW/um^2, i.e., as parsed for
+			/// the .power file
+			std::string power_dist = "normal";
+			double power_mean = 2.0, power_spread = 0.7;
+			/// ratio of hotspot blocks, only for bimodal distribution; their
+			/// power density is given by power_hotspot_factor * power_mean
+			double power_hotspot_ratio = 0.1, power_hotspot_factor = 5.0;
+
+			/// alignment requests
+			unsigned alignments = 0;
+			/// signals per alignment request, drawn uniformly from range
+			unsigned alignment_signals_min = 32, alignment_signals_max = 1024;
+
+			/// dies and utilization; only used for the recommended fixed
+			/// outline, to be put into the technology file
+			int dies = 2;
+			double utilization = 0.7;
+		} parameters;
+
+		/// generation of all data, in order of dependencies
+		void generate() {
+
+			this->rng.seed(this->parameters.seed);
+
+			this->generateBlocks();
+			this->generateTerminals();
+			this->generateNets();
+			this->generatePowerDensities();
+			this->generateAlignments();
+		};
+
+		/// recommended fixed outline, i.e., square die for given dies and
+		/// utilization
+		double outline() const {
+			return std::sqrt(this->blocks_area / (this->parameters.dies * this->parameters.utilization));
+		};
+
+		void writeFiles() const;
+
+	private:
+		/// random-number helpers
+		inline double randF(double const& min, double const& max) {
+			return std::uniform_real_distribution<double>(min, max)(this->rng);
+		};
+		inline unsigned randI(unsigned const& min, unsigned const& max) {
+			return std::uniform_int_distribution<unsigned>(min, max)(this->rng);
+		};
+
+		void generateBlocks() {
+			std::bernoulli_distribution soft(this->parameters.soft_ratio);
+			double area, AR;
+
+			this->blocks.clear();
+			this->blocks_area = 0.0;
+
+			for (unsigned b = 0; b < this->parameters.blocks; b++) {
+				Block block;
+
+				block.id = "sb" + std::to_string(b);
+				block.soft = soft(this->rng);
+
+				// log-uniform area, i.e., many small and few large blocks
+				area = std::exp(this->randF(std::log(this->parameters.area_min), std::log(this->parameters.area_max)));
+				// log-uniform aspect ratio, i.e., symmetric for [1/AR, AR]
+				AR = std::exp(this->randF(-std::log(this->parameters.AR), std::log(this->parameters.AR)));
+
+				// integer dimensions, as in the GSRC benchmarks
+				block.w = std::max(1.0, std::round(std::sqrt(area * AR)));
+				block.h = std::max(1.0, std::round(area / block.w));
+
+				this->blocks_area += block.w * block.h;
+				this->blocks.push_back(std::move(block));
+			}
+		};
+
+		void generateTerminals() {
+			double side, pos;
+
+			this->terminals.clear();
+
+			// terminals are distributed evenly along the perimeter of the
+			// recommended outline; IO::parseBlocks scales them to the actual
+			// outline anyway
+			side = this->outline();
+
+			for (unsigned t = 0; t < this->parameters.terminals; t++) {
+				Terminal terminal;
+
+				terminal.id = "p" + std::to_string(t + 1);
+
+				pos = 4.0 * side * t / this->parameters.terminals;
+
+				if (pos < side) {
+					terminal.x = pos;
+					terminal.y = 0.0;
+				}
+				else if (pos < 2.0 * side) {
+					terminal.x = side;
+					terminal.y = pos - side;
+				}
+				else if (pos < 3.0 * side) {
+					terminal.x = 3.0 * side - pos;
+					terminal.y = side;
+				}
+				else {
+					terminal.x = 0.0;
+					terminal.y = 4.0 * side - pos;
+				}
+
+				terminal.x = std::round(terminal.x);
+				terminal.y = std::round(terminal.y);
+
+				this->terminals.push_back(std::move(terminal));
+			}
+		};
+
+		unsigned netDegree() {
+			unsigned degree;
+
+			if (this->parameters.degree_dist == "uniform") {
+				degree = this->randI(2, this->parameters.degree_max);
+			}
+			// geometric distribution, shifted by 2 such that the mean matches
+			// the requested average degree
+			else {
+				double p = 1.0 / (std::max(this->parameters.degree_avg, 2.0) - 1.0);
+				degree = 2 + std::geometric_distribution<unsigned>(std::min(p, 1.0))(this->rng);
+			}
+
+			return std::min(degree, std::max(this->parameters.degree_max, 2u));
+		};
+
+		void generateNets() {
+			std::bernoulli_distribution terminal_net(this->parameters.terminal_net_ratio);
+			unsigned degree, window, window_start, terminal;
+			std::vector<unsigned> net_blocks;
+			bool connect_terminal;
+
+			this->nets.clear();
+
+			window = std::max(2u, static_cast<unsigned>(this->parameters.locality * this->parameters.blocks));
+			window = std::min(window, this->parameters.blocks);
+			terminal = 0;
+
+			for (unsigned n = 0; n < this->parameters.nets; n++) {
+				std::vector<std::string> net;
+
+				degree = this->netDegree();
+
+				// first nets are used to connect all terminals once; further
+				// nets connect randomly to terminals
+				connect_terminal = !this->terminals.empty() &&
+					(terminal < this->terminals.size() || terminal_net(this->rng));
+
+				if (connect_terminal) {
+
+					if (terminal < this->terminals.size()) {
+						net.push_back(this->terminals[terminal].id);
+						terminal++;
+					}
+					else {
+						net.push_back(this->terminals[this->randI(0, this->terminals.size() - 1)].id);
+					}
+
+					degree--;
+				}
+
+				// draw distinct blocks from a local window
+				degree = std::min(degree, window);
+				window_start = this->randI(0, this->parameters.blocks - window);
+
+				net_blocks.clear();
+				while (net_blocks.size() < degree) {
+					unsigned b = window_start + this->randI(0, window - 1);
+
+					if (std::find(net_blocks.begin(), net_blocks.end(), b) == net_blocks.end()) {
+						net_blocks.push_back(b);
+					}
+				}
+
+				for (unsigned b : net_blocks) {
+					net.push_back(this->blocks[b].id);
+				}
+
+				this->nets.push_back(std::move(net));
+			}
+
+			if (terminal < this->terminals.size()) {
+				std::cout << "Generator> Note: only " << terminal << " out of " << this->terminals.size() << " terminals are connected; increase the number of nets" << std::endl;
+			}
+		};
+
+		void generatePowerDensities() {
+			std::string const& dist = this->parameters.power_dist;
+			double const& mean = this->parameters.power_mean;
+			double const& spread = this->parameters.power_spread;
+			std::normal_distribution<double> normal(mean, spread);
+			// parameters of the underlying normal distribution, such that mean
+			// and std deviation of the lognormal distribution match the given
+			// values
+			double sigma2 = std::log(1.0 + (spread * spread) / (mean * mean));
+			std::lognormal_distribution<double> lognormal(std::log(mean) - sigma2 / 2.0, std::sqrt(sigma2));
+			std::bernoulli_distribution hotspot(this->parameters.power_hotspot_ratio);
+
+			for (Block& block : this->blocks) {
+
+				if (dist == "uniform") {
+					block.power_density = this->randF(std::max(0.0, mean - spread), mean + spread);
+				}
+				else if (dist == "lognormal") {
+					block.power_density = lognormal(this->rng);
+				}
+				else if (dist == "bimodal") {
+					block.power_density = normal(this->rng);
+					if (hotspot(this->rng)) {
+						block.power_density *= this->parameters.power_hotspot_factor;
+					}
+				}
+				// normal
+				else {
+					block.power_density = normal(this->rng);
+				}
+
+				// limit to positive, non-trivial values
+				block.power_density = std::max(block.power_density, 0.01 * mean);
+			}
+		};
+
+		void generateAlignments() {
+			std::vector<unsigned> ids;
+			unsigned signals;
+			double overlap, range;
+			Block const* b1;
+			Block const* b2;
+
+			this->alignments.clear();
+
+			if (this->parameters.alignments == 0) {
+				return;
+			}
+
+			// each block is considered in at most one request, thus blocks are
+			// drawn from a shuffled list
+			for (unsigned b = 0; b < this->blocks.size(); b++) {
+				ids.push_back(b);
+			}
+			std::shuffle(ids.begin(), ids.end(), this->rng);
+
+			for (unsigned a = 0; a < this->parameters.alignments && 2 * a + 1 < ids.size(); a++) {
+				std::stringstream request;
+
+				b1 = &this->blocks[ids[2 * a]];
+				b2 = &this->blocks[ids[2 * a + 1]];
+
+				signals = this->randI(this->parameters.alignment_signals_min, this->parameters.alignment_signals_max);
+
+				// overlap limited to fraction of the smaller block; note that the
+				// blocks' dimensions are scaled by Corblivar according to the
+				// technology file, but the requests are not
+				overlap = std::round(0.5 * std::min(std::min(b1->w, b1->h), std::min(b2->w, b2->h)));
+				range = std::round(std::sqrt(this->blocks_area / this->blocks.size()));
+
+				request << "( ";
+
+				switch (this->randI(0, 2)) {
+					// strict vertical bus, i.e., overlap in both dimensions
+					case 0:
+						request << "STRICT " << signals << " " << b1->id << " " << b2->id;
+						request << " MIN " << overlap << " MIN " << overlap;
+						break;
+					// flexible horizontal bus, i.e., x-overlap and y-range
+					case 1:
+						request << "FLEXIBLE " << signals << " " << b1->id << " " << b2->id;
+						request << " MIN " << overlap << " MAX " << range;
+						break;
+					// flexible vertical bus, i.e., x-range and y-overlap
+					default:
+						request << "FLEXIBLE " << signals << " " << b1->id << " " << b2->id;
+						request << " MAX " << range << " MIN " << overlap;
+						break;
+				}
+
+				request << " )";
+
+				this->alignments.push_back(request.str());
+			}
+
+			if (this->alignments.size() < this->parameters.alignments) {
+				std::cout << "Generator> Note: only " << this->alignments.size() << " alignment requests could be generated; too few blocks" << std::endl;
+			}
+		};
+};
+
+void BenchmarkGenerator::writeFiles() const {
+	std::ofstream file;
+	std::string const prefix = this->parameters.dir + "/" + this->parameters.name;
+	unsigned soft_blocks, pins;
+
+	// blocks file
+	//
+	file.open(prefix + ".blocks");
+	if (!file.good()) {
+		std::cout << "Generator> Cannot write to " << prefix << ".blocks; check the output dir!" << std::endl;
+		exit(1);
+	}
+
+	soft_blocks = 0;
+	for (Block const& block : this->blocks) {
+		if (block.soft) {
+			soft_blocks++;
+		}
+	}
+
+	file << "UCSC blocks 1.0" << std::endl;
+	file << "# Created      : by Corblivar benchmark generator" << std::endl;
+	file << "# Seed         : " << this->parameters.seed << std::endl;
+	file << "# Blocks area  : " << static_cast<unsigned long>(this->blocks_area) << std::endl;
+	file << "# Outline      : " << this->outline() << " x " << this->outline();
+	file << " (recommended for " << this->parameters.dies << " dies and utilization " << this->parameters.utilization << ")" << std::endl;
+	file << std::endl;
+	file << "NumSoftRectangularBlocks : " << soft_blocks << std::endl;
+	file << "NumHardRectilinearBlocks : " << this->blocks.size() - soft_blocks << std::endl;
+	file << "NumTerminals : " << this->terminals.size() << std::endl;
+	file << std::endl;
+
+	for (Block const& block : this->blocks) {
+
+		if (block.soft) {
+			file << block.id << " softrectangular " << block.w * block.h;
+			file << " " << 1.0 / this->parameters.AR << " " << this->parameters.AR << std::endl;
+		}
+		else {
+			file << block.id << " hardrectilinear 4 (0, 0) (0, " << block.h << ") (";
+			file << block.w << ", " << block.h << ") (" << block.w << ", 0)" << std::endl;
+		}
+	}
+	file << std::endl;
+
+	for (Terminal const& terminal : this->terminals) {
+		file << terminal.id << " terminal" << std::endl;
+	}
+
+	file.close();
+
+	// nets file
+	//
+	file.open(prefix + ".nets");
+
+	pins = 0;
+	for (std::vector<std::string> const& net : this->nets) {
+		pins += net.size();
+	}
+
+	file << "UCLA nets 1.0" << std::endl;
+	file << "# Created      : by Corblivar benchmark generator" << std::endl;
+	file << "# Seed         : " << this->parameters.seed << std::endl;
+	file << std::endl;
+	file << "NumNets : " << this->nets.size() << std::endl;
+	file << "NumPins : " << pins << std::endl;
+
+	for (std::vector<std::string> const& net : this->nets) {
+
+		file << "NetDegree : " << net.size() << std::endl;
+
+		for (std::string const& pin : net) {
+			file << pin << " B" << std::endl;
+		}
+	}
+
+	file.close();
+
+	// pl file; blocks are not placed, only terminals
+	//
+	file.open(prefix + ".pl");
+
+	file << "UCLA pl 1.0" << std::endl;
+	file << std::endl;
+
+	for (Block const& block : this->blocks) {
+		file << block.id << "\t0\t0" << std::endl;
+	}
+	for (Terminal const& terminal : this->terminals) {
+		file << terminal.id << "\t" << terminal.x << "\t" << terminal.y << std::endl;
+	}
+
+	file.close();
+
+	// power file; in order of blocks
+	//
+	file.open(prefix + ".power");
+
+	file << "# power density in 10^6 W/m^2 = uW/um^2 end" << std::endl;
+	for (Block const& block : this->blocks) {
+		file << block.power_density << std::endl;
+	}
+
+	file.close();
+
+	// alignment-requests file
+	//
+	file.open(prefix + ".alr");
+
+	file << "# Created      : by Corblivar benchmark generator" << std::endl;
+	file << "# Seed         : " << this->parameters.seed << std::endl;
+	file << "#" << std::endl;
+	file << "# syntax: ( TYPE SIGNALS BLOCK_1 BLOCK_2 TYPE_X VALUE_X TYPE_Y VALUE_Y )" << std::endl;
+	file << "# note that the overlap values are derived from unscaled blocks' dimensions" << std::endl;
+	file << "# data_start" << std::endl;
+
+	for (std::string const& request : this->alignments) {
+		file << request << std::endl;
+	}
+
+	file.close();
+}
+
+int main (int argc, char** argv) {
+	BenchmarkGenerator gen;
+	BenchmarkGenerator::Parameters& p = gen.parameters;
+	std::string option;
+
+	std::cout << std::endl;
+	std::cout << "Corblivar benchmark generator" << std::endl;
+	std::cout << "-----------------------------" << std::endl;
+	std::cout << std::endl;
+
+	if (argc < 2 || (argc % 2) != 0) {
+		std::cout << "Generator> Usage: " << argv[0] << " benchmark_name [--option value ...]" << std::endl;
+		std::cout << "Generator> " << std::endl;
+		std::cout << "Generator> Options and default values:" << std::endl;
+		std::cout << "Generator>  --dir " << p.dir << "                  output dir" << std::endl;
+		std::cout << "Generator>  --seed " << p.seed << "                 seed for random-number generation" << std::endl;
+		std::cout << "Generator>  --blocks " << p.blocks << "             number of blocks" << std::endl;
+		std::cout << "Generator>  --soft-ratio " << p.soft_ratio << "           ratio of soft blocks" << std::endl;
+		std::cout << "Generator>  --area-min " << p.area_min << "          min block area, in um^2" << std::endl;
+		std::cout << "Generator>  --area-max " << p.area_max << "          max block area, in um^2" << std::endl;
+		std::cout << "Generator>  --aspect-ratio " << p.AR << "         max block aspect ratio" << std::endl;
+		std::cout << "Generator>  --terminals " << p.terminals << "          number of terminal pins" << std::endl;
+		std::cout << "Generator>  --nets " << p.nets << "               number of nets" << std::endl;
+		std::cout << "Generator>  --degree-dist " << p.degree_dist << "  net-degree distribution: geometric, uniform" << std::endl;
+		std::cout << "Generator>  --degree-avg " << p.degree_avg << "         avg net degree, only for geometric distribution" << std::endl;
+		std::cout << "Generator>  --degree-max " << p.degree_max << "          max net degree" << std::endl;
+		std::cout << "Generator>  --terminal-nets " << p.terminal_net_ratio << "       ratio of nets connecting to a terminal" << std::endl;
+		std::cout << "Generator>  --locality " << p.locality << "            window of blocks per net, as ratio of all blocks" << std::endl;
+		std::cout << "Generator>  --power-dist " << p.power_dist << "     power-density distribution: uniform, normal, lognormal, bimodal" << std::endl;
+		std::cout << "Generator>  --power-mean " << p.power_mean << "           mean power density, in uW/um^2" << std::endl;
+		std::cout << "Generator>  --power-spread " << p.power_spread << "       std deviation, or half range for uniform distribution" << std::endl;
+		std::cout << "Generator>  --hotspot-ratio " << p.power_hotspot_ratio << "      ratio of hotspot blocks, only for bimodal distribution" << std::endl;
+		std::cout << "Generator>  --hotspot-factor " << p.power_hotspot_factor << "       power-density factor of hotspot blocks" << std::endl;
+		std::cout << "Generator>  --alignments " << p.alignments << "           number of alignment requests" << std::endl;
+		std::cout << "Generator>  --dies " << p.dies << "                 dies, only for recommended outline" << std::endl;
+		std::cout << "Generator>  --utilization " << p.utilization << "        utilization, only for recommended outline" << std::endl;
+
+		exit(1);
+	}
+
+	p.name = argv[1];
+
+	for (int i = 2; i < argc; i += 2) {
+
+		option = argv[i];
+
+		if (option == "--dir") {
+			p.dir = argv[i + 1];
+		}
+		else if (option == "--seed") {
+			p.seed = std::stoul(argv[i + 1]);
+		}
+		else if (option == "--blocks") {
+			p.blocks = std::stoul(argv[i + 1]);
+		}
+		else if (option == "--soft-ratio") {
+			p.soft_ratio = std::stod(argv[i + 1]);
+		}
+		else if (option == "--area-min") {
+			p.area_min = std::stod(argv[i + 1]);
+		}
+		else if (option == "--area-max") {
+			p.area_max = std::stod(argv[i + 1]);
+		}
+		else if (option == "--aspect-ratio") {
+			p.AR = std::stod(argv[i + 1]);
+		}
+		else if (option == "--terminals") {
+			p.terminals = std::stoul(argv[i + 1]);
+		}
+		else if (option == "--nets") {
+			p.nets = std::stoul(argv[i + 1]);
+		}
+		else if (option == "--degree-dist") {
+			p.degree_dist = argv[i + 1];
+		}
+		else if (option == "--degree-avg") {
+			p.degree_avg = std::stod(argv[i + 1]);
+		}
+		else if (option == "--degree-max") {
+			p.degree_max = std::stoul(argv[i + 1]);
+		}
+		else if (option == "--terminal-nets") {
+			p.terminal_net_ratio = std::stod(argv[i + 1]);
+		}
+		else if (option == "--locality") {
+			p.locality = std::stod(argv[i + 1]);
+		}
+		else if (option == "--power-dist") {
+			p.power_dist = argv[i + 1];
+		}
+		else if (option == "--power-mean") {
+			p.power_mean = std::stod(argv[i + 1]);
+		}
+		else if (option == "--power-spread") {
+			p.power_spread = std::stod(argv[i + 1]);
+		}
+		else if (option == "--hotspot-ratio") {
+			p.power_hotspot_ratio = std::stod(argv[i + 1]);
+		}
+		else if (option == "--hotspot-factor") {
+			p.power_hotspot_factor = std::stod(argv[i + 1]);
+		}
+		else if (option == "--alignments") {
+			p.alignments = std::stoul(argv[i + 1]);
+		}
+		else if (option == "--dies") {
+			p.dies = std::stoi(argv[i + 1]);
+		}
+		else if (option == "--utilization") {
+			p.utilization = std::stod(argv[i + 1]);
+		}
+		else {
+			std::cout << "Generator> Unknown option: " << option << std::endl;
+			exit(1);
+		}
+	}
+
+	// sanity checks
+	if (p.blocks < 2) {
+		std::cout << "Generator> At least two blocks are required!" << std::endl;
+		exit(1);
+	}
+	if (p.area_min <= 0.0 || p.area_max < p.area_min) {
+		std::cout << "Generator> Invalid range for blocks' area!" << std::endl;
+		exit(1);
+	}
+	if (p.AR < 1.0) {
+		std::cout << "Generator> The aspect ratio limit has to be at least 1.0!" << std::endl;
+		exit(1);
+	}
+	if (p.degree_dist != "geometric" && p.degree_dist != "uniform") {
+		std::cout << "Generator> Unknown net-degree distribution: " << p.degree_dist << std::endl;
+		exit(1);
+	}
+	if (p.power_dist != "uniform" && p.power_dist != "normal" && p.power_dist != "lognormal" && p.power_dist != "bimodal") {
+		std::cout << "Generator> Unknown power-density distribution: " << p.power_dist << std::endl;
+		exit(1);
+	}
+	if (p.power_mean <= 0.0 || p.power_spread < 0.0) {
+		std::cout << "Generator> Invalid parameters for power-density distribution!" << std::endl;
+		exit(1);
+	}
+	if (p.dies < 1 || p.utilization <= 0.0) {
+		std::cout << "Generator> Invalid dies or utilization!" << std::endl;
+		exit(1);
+	}
+
+	gen.generate();
+	gen.writeFiles();
+
+	std::cout << "Generator> Benchmark " << p.name << " written to " << p.dir << "; seed " << p.seed << std::endl;
+	std::cout << "Generator>  " << p.blocks << " blocks, " << p.terminals << " terminals, " << p.nets << " nets, " << p.alignments << " alignment requests" << std::endl;
+	std::cout << "Generator>  Recommended fixed outline for " << p.dies << " dies and utilization " << p.utilization << ": ";
+	std::cout << gen.outline() << " x " << gen.outline() << " um^2" << std::endl;
+	std::cout << std::endl;
+
+	return 0;
+}
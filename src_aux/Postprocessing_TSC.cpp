@@ -38,6 +38,12 @@ static constexpr unsigned SAMPLING_ITERATIONS = 10;
 static constexpr double MEAN_TO_STD_DEV_FACTOR = 0.1;
 // for dummy TSV insertion, consider all bins with correlations above this fraction of the worst correlation per layer
 static constexpr double MAX_CORR_RANGE = 0.99;
+// sampling via HotSpot, i.e., external detailed simulation for each sample and each round; otherwise, the in-process evaluator based on power blurring is used
+static constexpr bool HOTSPOT_SAMPLING = false;
+// convergence tracking; an iteration is considered as improvement only if the avg correlation of some layer is reduced by more than this value
+static constexpr double CONVERGENCE_TOLERANCE = 1.0e-4;
+// convergence tracking; upper limit for iterations of dummy TSV insertion
+static constexpr unsigned MAX_ITERATIONS = 100;
 
 // type definitions, for shorter notation
 typedef	std::array< std::array< std::array<double, SAMPLING_ITERATIONS> , ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> samples_data_layer_type;
@@ -46,6 +52,17 @@ typedef std::array< std::array<double, ThermalAnalyzer::THERMAL_MAP_DIM>, Therma
 // copied from Variation_TSC
 typedef	std::array< std::array<ThermalAnalyzer::ThermalMapBin, ThermalAnalyzer::THERMAL_MAP_DIM>, ThermalAnalyzer::THERMAL_MAP_DIM> thermal_maps_layer_type;
 typedef	std::vector< thermal_maps_layer_type > thermal_maps_type;
+// in-process evaluator; padded maps, as for power blurring
+typedef std::array< std::array<double, ThermalAnalyzer::POWER_MAPS_DIM>, ThermalAnalyzer::POWER_MAPS_DIM> blurring_map_layer_type;
+typedef std::vector< blurring_map_layer_type > blurring_maps_type;
+
+// in-process evaluator; the thermal maps of all samples, as required for the correlations, are kept in temp_samples
+struct InProcessEvaluator {
+	// power maps of all samples, w/o adaptation for TSVs; [sampling_iter][layer]
+	std::vector< blurring_maps_type > power_maps;
+	// power-scaling factors of bins, derived from TSV densities; same for all samples; [layer]
+	blurring_maps_type TSV_factors;
+};
 
 // forward declaration
 void parseHotSpotFiles(FloorPlanner& fp, unsigned sampling_iter, samples_data_type& temp_samples);
@@ -53,6 +70,10 @@ void writeHotSpotPtrace(FloorPlanner& fp);
 void writeHotSpotFiles__passiveSi_bonding(FloorPlanner& fp);
 // copied and adapted from Variation_TSC
 void parseHotSpotFiles(FloorPlanner& fp, std::string const& benchmark_suffix, thermal_maps_type& thermal_maps);
+// in-process evaluator
+void determineTSVFactors(FloorPlanner& fp, blurring_maps_type& TSV_factors);
+void sampleThermalMaps(FloorPlanner& fp, unsigned sampling_iter, InProcessEvaluator& evaluator, samples_data_type& temp_samples);
+unsigned updateThermalMaps(FloorPlanner& fp, InProcessEvaluator& evaluator, blurring_maps_type const& TSV_factors, samples_data_type& temp_samples);
 
 int main (int argc, char** argv) {
 	FloorPlanner fp;
@@ -85,7 +106,12 @@ int main (int argc, char** argv) {
 	int adapted_bins = 0;
 	int prev_adapted_bins;
 
-	std::list<std::string> dummy_TSVs_to_delete;
+	unsigned iteration = 0;
+	unsigned changed_bins;
+	InProcessEvaluator evaluator;
+	blurring_maps_type TSV_factors;
+
+	std::list<int> dummy_TSVs_to_delete;
 
 	std::vector<TSV_Island> original_dummy_TSVs = fp.getDummyTSVs();
 
@@ -148,90 +174,114 @@ int main (int argc, char** argv) {
 
 	// iteratively try to reduce the worst correlations over each layer
 	//
+	// for the in-process evaluator, the power-scaling factors for the original TSVs are required for the initial samples
+	//
+	if (!HOTSPOT_SAMPLING) {
+
+		fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
+		fp.editThermalAnalyzer().adaptPowerMapsTSVs(fp.getLayers(), fp.getTSVs(), fp.getDummyTSVs(), fp.getPowerBlurringParameters());
+
+		determineTSVFactors(fp, evaluator.TSV_factors);
+	}
+
 	run = true;
 	while (run) {
 
-		// clear local samples_data_type
-		//
-		power_samples.clear();
-		temp_samples.clear();
-		correlations.clear();
+		iteration++;
 
-		// allocate vectors
+		correlations.clear();
 		for (int layer = 0; layer < fp.getLayers(); layer++) {
-
-			power_samples.emplace_back(samples_data_layer_type());
-			temp_samples.emplace_back(samples_data_layer_type());
 			correlations.emplace_back(correlations_layer_type());
 		}
 
-		// generate power data and gather related HotSpot simulation temperature data
+		// generate power data and gather related temperature data; for HotSpot, this is required for each iteration, whereas the in-process evaluator keeps the
+		// same samples over all iterations, updated incrementally for the TSV adaptations, see below
 		//
-		for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
+		if (HOTSPOT_SAMPLING || iteration == 1) {
 
-			std::cout << std::endl;
-			std::cout << "Sampling iteration: " << (sampling_iter + 1) << "/" << SAMPLING_ITERATIONS << std::endl;
-			std::cout << "------------------------------" << std::endl;
-
-			// first, randomly vary power densities in blocks
+			// clear local samples_data_type
 			//
-			for (Block const& b : fp.getBlocks()) {
+			power_samples.clear();
+			temp_samples.clear();
 
-				// restore original value, used as mean for Gaussian distribution of power densities
-				b.power_density_unscaled = b.power_density_unscaled_back;
+			// allocate vectors
+			for (int layer = 0; layer < fp.getLayers(); layer++) {
+
+				power_samples.emplace_back(samples_data_layer_type());
+				temp_samples.emplace_back(samples_data_layer_type());
+			}
 
-				// calculate new power value, based on Gaussian distribution
-				std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * MEAN_TO_STD_DEV_FACTOR);
+			for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
 
-				b.power_density_unscaled = gaussian(random_generator);
+				std::cout << std::endl;
+				std::cout << "Sampling iteration: " << (sampling_iter + 1) << "/" << SAMPLING_ITERATIONS << std::endl;
+				std::cout << "------------------------------" << std::endl;
 
-				if (DBG) {
-					std::cout << "Block " << b.id << ":" << std::endl;
-					std::cout << " Original power = " << b.power_density_unscaled_back << std::endl;
-					std::cout << " New random power = " << b.power_density_unscaled << std::endl;
+				// first, randomly vary power densities in blocks
+				//
+				for (Block const& b : fp.getBlocks()) {
+
+					// restore original value, used as mean for Gaussian distribution of power densities
+					b.power_density_unscaled = b.power_density_unscaled_back;
+
+					// calculate new power value, based on Gaussian distribution
+					std::normal_distribution<double> gaussian(b.power_density_unscaled, b.power_density_unscaled * MEAN_TO_STD_DEV_FACTOR);
+
+					b.power_density_unscaled = gaussian(random_generator);
+
+					if (DBG) {
+						std::cout << "Block " << b.id << ":" << std::endl;
+						std::cout << " Original power = " << b.power_density_unscaled_back << std::endl;
+						std::cout << " New random power = " << b.power_density_unscaled << std::endl;
+					}
 				}
-			}
 
-			// second, generate new power maps
-			//
-			fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
+				// second, generate new power maps
+				//
+				fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
 
-			// copy data from Corblivar power maps into local data structure power_samples
-			//
-			for (int layer = 0; layer < fp.getLayers(); layer++) {
-				for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-					for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+				// copy data from Corblivar power maps into local data structure power_samples
+				//
+				for (int layer = 0; layer < fp.getLayers(); layer++) {
+					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-						power_samples[layer][x][y][sampling_iter] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
+							power_samples[layer][x][y][sampling_iter] = fp.getThermalAnalyzer().getPowerMapsOrig()[layer][x][y].power_density;
+						}
 					}
 				}
-			}
 
-			// third, run HotSpot on this new map
-			//
-			// generate new ptrace file first
-			writeHotSpotPtrace(fp);
-			// HotSpot.sh system call
-			system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
+				// third, run HotSpot on this new map, and read in the new HotSpot results into local data structure temp_samples
+				//
+				if (HOTSPOT_SAMPLING) {
 
-			// fourth, read in the new HotSpot results into local data structure temp_samples
-			//
-			parseHotSpotFiles(fp, sampling_iter, temp_samples);
+					// generate new ptrace file first
+					writeHotSpotPtrace(fp);
+					// HotSpot.sh system call
+					system(std::string("./HotSpot.sh " + fp.getBenchmark() + " " + std::to_string(fp.getLayers())).c_str());
 
+					parseHotSpotFiles(fp, sampling_iter, temp_samples);
+				}
+				// or, run the in-process evaluator on this new map
+				else {
+					sampleThermalMaps(fp, sampling_iter, evaluator, temp_samples);
+				}
 
-			if (DBG) {
-				std::cout << "Printing gathered power/temperature data for sampling iteration " << sampling_iter << std::endl;
-				std::cout << std::endl;
 
-				for (int layer = 0; layer < fp.getLayers(); layer++) {
-					std::cout << " Layer " << layer << std::endl;
+				if (DBG) {
+					std::cout << "Printing gathered power/temperature data for sampling iteration " << sampling_iter << std::endl;
 					std::cout << std::endl;
 
-					for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-						for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+					for (int layer = 0; layer < fp.getLayers(); layer++) {
+						std::cout << " Layer " << layer << std::endl;
+						std::cout << std::endl;
+
+						for (unsigned x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+							for (unsigned y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
 
-							std::cout << "  Power[" << x << "][" << y << "]: " << power_samples[layer][x][y][sampling_iter] << std::endl;
-							std::cout << "  Temp [" << x << "][" << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
+								std::cout << "  Power[" << x << "][" << y << "]: " << power_samples[layer][x][y][sampling_iter] << std::endl;
+								std::cout << "  Temp [" << x << "][" << y << "]: " << temp_samples[layer][x][y][sampling_iter] << std::endl;
+							}
 						}
 					}
 				}
@@ -377,13 +427,41 @@ int main (int argc, char** argv) {
 			//
 			for (int layer = 0; layer < fp.getLayers(); layer++) {
 
-				if (correlation_avgs[layer] < prev_correlation_avgs[layer]) {
+				if (correlation_avgs[layer] < (prev_correlation_avgs[layer] - CONVERGENCE_TOLERANCE)) {
 					run = true;
 					break;
 				}
 			}
 		}
 
+		// convergence tracking
+		//
+		std::cout << std::endl;
+		std::cout << "Iteration " << iteration << "; dummy TSVs: " << fp.getDummyTSVs().size();
+		if (!prev_correlation_avgs.empty()) {
+			std::cout << "; change of avg Pearson correlations on layers:";
+			for (int layer = 0; layer < fp.getLayers(); layer++) {
+				std::cout << " " << correlation_avgs[layer] - prev_correlation_avgs[layer];
+			}
+		}
+		std::cout << std::endl;
+
+		// limit iterations; the current iteration was an improvement, so its dummy TSVs are kept and it is considered as final result, by memorizing it as
+		// previous iteration
+		//
+		if (run && iteration == MAX_ITERATIONS) {
+
+			std::cout << std::endl;
+			std::cout << "Limit of iterations reached: " << MAX_ITERATIONS << std::endl;
+
+			run = false;
+			dummy_TSVs_to_delete.clear();
+
+			prev_correlation_avgs = correlation_avgs;
+			prev_max_correlation_avgs = max_correlation_avgs;
+			prev_std_dev_correlation_avgs = std_dev_correlation_avgs;
+		}
+
 		// at least for one layer there was an improvement compared to the previous iteration; so we try further; note that this may worsen other layers on the other hand
 		//
 		if (run) {
@@ -424,14 +502,12 @@ int main (int argc, char** argv) {
 							bb.ur.x = (x + 1) * (fp.getOutline().x / ThermalAnalyzer::THERMAL_MAP_DIM);
 							bb.ur.y = (y + 1) * (fp.getOutline().y / ThermalAnalyzer::THERMAL_MAP_DIM);
 
-							// generate id
-							std::string id = std::string("dummy_"
-										+ std::to_string(x) + "_"
-										+ std::to_string(y) + "_"
-										+ std::to_string(layer));
+							// generate id; index of bin
+							int id = (layer * ThermalAnalyzer::THERMAL_MAP_DIM + x) * ThermalAnalyzer::THERMAL_MAP_DIM + y;
 
 							// now, insert a dummy TSV
 							fp.editDummyTSVs().emplace_back(TSV_Island(
+									TSV_Island::Type::DUMMY,
 									id,
 									// one TSV count
 									1,
@@ -466,10 +542,13 @@ int main (int argc, char** argv) {
 			//
 			// note that this will also re-scale power_maps.power_density, so we should not access those values during this iteration any more
 			//
-			fp.editThermalAnalyzer().adaptPowerMapsTSVs(fp.getLayers(), fp.getTSVs(), fp.getDummyTSVs(), fp.getPowerBlurringParameters());
+			if (HOTSPOT_SAMPLING) {
 
-			// generate new HotSpot files for Si and bonding layers; adapted by TSVs
-			writeHotSpotFiles__passiveSi_bonding(fp);
+				fp.editThermalAnalyzer().adaptPowerMapsTSVs(fp.getLayers(), fp.getTSVs(), fp.getDummyTSVs(), fp.getPowerBlurringParameters());
+
+				// generate new HotSpot files for Si and bonding layers; adapted by TSVs
+				writeHotSpotFiles__passiveSi_bonding(fp);
+			}
 
 			// prepare next run
 			//
@@ -478,8 +557,24 @@ int main (int argc, char** argv) {
 
 				b.power_density_unscaled = b.power_density_unscaled_back;
 			}
-			// generate new/original ptrace file
-			writeHotSpotPtrace(fp);
+
+			if (HOTSPOT_SAMPLING) {
+
+				// generate new/original ptrace file
+				writeHotSpotPtrace(fp);
+			}
+			// for the in-process evaluator, the TSV densities are determined on newly generated maps; the thermal maps of all samples are then updated only
+			// for the bins w/ changed TSV densities
+			else {
+				fp.editThermalAnalyzer().generatePowerMaps(fp.getLayers(), fp.getBlocks(), fp.getOutline(), fp.getPowerBlurringParameters());
+				fp.editThermalAnalyzer().adaptPowerMapsTSVs(fp.getLayers(), fp.getTSVs(), fp.getDummyTSVs(), fp.getPowerBlurringParameters());
+
+				determineTSVFactors(fp, TSV_factors);
+				changed_bins = updateThermalMaps(fp, evaluator, TSV_factors, temp_samples);
+
+				std::cout << std::endl;
+				std::cout << " Bins w/ changed TSV densities: " << changed_bins << std::endl;
+			}
 
 			std::cout << std::endl;
 			std::cout << "Continue with next sampling round" << std::endl;
@@ -492,12 +587,13 @@ int main (int argc, char** argv) {
 	std::cout << "------------------------------------------------------------" << std::endl;
 	std::cout << std::endl;
 
-	// remove dummy TSVs added during previous iteration
-	for (std::string const& id : dummy_TSVs_to_delete) {
+	// remove dummy TSVs added during previous iteration; the original dummy TSVs are
+	// never deleted, their ids are not related to bins
+	for (int const& id : dummy_TSVs_to_delete) {
 
 		unsigned dummy_TSVs_count = fp.getDummyTSVs().size();
 
-		for (unsigned i = 0; i < dummy_TSVs_count; i++) {
+		for (unsigned i = original_dummy_TSVs.size(); i < dummy_TSVs_count; i++) {
 
 			// we may have reached the end of vector already, in case some islands have been already deleted
 			if (i >= fp.getDummyTSVs().size()) {
@@ -903,3 +999,186 @@ void parseHotSpotFiles(FloorPlanner& fp, std::string const& benchmark_suffix, th
 		layer_file.close();
 	}
 }
+
+// in-process evaluator; the power-scaling factors are derived from the TSV densities, as in ThermalAnalyzer::adaptPowerMapsTSVs; requires maps adapted for TSVs
+//
+void determineTSVFactors(FloorPlanner& fp, blurring_maps_type& TSV_factors) {
+	double TSV_density;
+
+	TSV_factors.clear();
+
+	for (int layer = 0; layer < fp.getLayers(); layer++) {
+
+		TSV_factors.emplace_back(blurring_map_layer_type());
+
+		// init factors; no scaling for padded bins
+		for (auto& m : TSV_factors[layer]) {
+			m.fill(1.0);
+		}
+
+		for (unsigned x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			for (unsigned y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+
+				TSV_density = fp.getThermalAnalyzer().getPowerMaps()[layer][x][y].TSV_density;
+
+				TSV_factors[layer][x][y] = 1.0 + ((fp.getPowerBlurringParameters().power_density_scaling_TSV_region - 1.0) / 100.0) * TSV_density;
+			}
+		}
+	}
+}
+
+// in-process evaluator; determines the thermal maps of all layers for the current sample, via power blurring; requires power maps generated for the sample, but
+// not adapted for TSVs
+//
+// in contrast to ThermalAnalyzer::performPowerBlurring, which estimates the thermal map only for the lowermost layer, the maps are estimated for all layers,
+// using the masks according to the distance of layers; this is sufficient for the correlations, which are independent of offset and scaling of temperatures;
+// wires are ignored, their power is not sampled
+//
+void sampleThermalMaps(FloorPlanner& fp, unsigned sampling_iter, InProcessEvaluator& evaluator, samples_data_type& temp_samples) {
+	unsigned map_x, map_y;
+	unsigned i;
+	double power;
+	std::vector< std::array<double, ThermalAnalyzer::THERMAL_MASK_DIM> > const& masks = fp.getThermalAnalyzer().getThermalMasks();
+	// buffer for separated convolution, see ThermalAnalyzer::performPowerBlurring
+	blurring_map_layer_type thermal_map_tmp;
+
+	// memorize power maps of sample; required for incremental updates
+	//
+	if (evaluator.power_maps.size() <= sampling_iter) {
+		evaluator.power_maps.resize(sampling_iter + 1);
+	}
+	evaluator.power_maps[sampling_iter].clear();
+
+	for (int layer = 0; layer < fp.getLayers(); layer++) {
+
+		evaluator.power_maps[sampling_iter].emplace_back(blurring_map_layer_type());
+
+		for (unsigned x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
+			for (unsigned y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+				evaluator.power_maps[sampling_iter][layer][x][y] = fp.getThermalAnalyzer().getPowerMaps()[layer][x][y].power_density;
+			}
+		}
+	}
+
+	// power blurring, for each layer considering the heat sources of all layers
+	//
+	for (int layer = 0; layer < fp.getLayers(); layer++) {
+
+		// init thermal map w/ temperature offset
+		for (map_x = 0; map_x < ThermalAnalyzer::THERMAL_MAP_DIM; map_x++) {
+			for (map_y = 0; map_y < ThermalAnalyzer::THERMAL_MAP_DIM; map_y++) {
+				temp_samples[layer][map_x][map_y][sampling_iter] = fp.getPowerBlurringParameters().temp_offset;
+			}
+		}
+
+		for (int source_layer = 0; source_layer < fp.getLayers(); source_layer++) {
+
+			std::array<double, ThermalAnalyzer::THERMAL_MASK_DIM> const& mask = masks[std::abs(layer - source_layer)];
+			blurring_map_layer_type const& power_map = evaluator.power_maps[sampling_iter][source_layer];
+			blurring_map_layer_type const& TSV_factors = evaluator.TSV_factors[source_layer];
+
+			// horizontal 1D convolution, over the full y-dimension of the padded maps
+			for (unsigned y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+				for (unsigned x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+
+					thermal_map_tmp[x][y] = 0.0;
+
+					for (unsigned mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+
+						i = x + mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER;
+						power = power_map[i][y] * TSV_factors[i][y];
+
+						thermal_map_tmp[x][y] += power * mask[mask_i];
+					}
+				}
+			}
+
+			// vertical 1D convolution, into the thermal map
+			for (unsigned x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+
+				map_x = x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+
+				for (unsigned y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+
+					map_y = y - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+
+					for (unsigned mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+
+						i = y + mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER;
+
+						temp_samples[layer][map_x][map_y][sampling_iter] += thermal_map_tmp[x][i] * mask[mask_i];
+					}
+				}
+			}
+		}
+	}
+}
+
+// in-process evaluator; updates the thermal maps of all samples for changed power-scaling factors, i.e., for changed TSV densities; as power blurring is linear,
+// only the power differences of the changed bins are to be convolved, which affects only the thermal-map bins within the masks' range
+//
+// returns the count of changed bins
+//
+unsigned updateThermalMaps(FloorPlanner& fp, InProcessEvaluator& evaluator, blurring_maps_type const& TSV_factors, samples_data_type& temp_samples) {
+	unsigned changed_bins;
+	int map_x, map_y;
+	double factor_diff, power_diff;
+	std::vector< std::array<double, ThermalAnalyzer::THERMAL_MASK_DIM> > const& masks = fp.getThermalAnalyzer().getThermalMasks();
+
+	changed_bins = 0;
+
+	for (int source_layer = 0; source_layer < fp.getLayers(); source_layer++) {
+
+		for (unsigned x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			for (unsigned y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+
+				factor_diff = TSV_factors[source_layer][x][y] - evaluator.TSV_factors[source_layer][x][y];
+
+				if (factor_diff == 0.0) {
+					continue;
+				}
+
+				changed_bins++;
+				evaluator.TSV_factors[source_layer][x][y] = TSV_factors[source_layer][x][y];
+
+				for (unsigned sampling_iter = 0; sampling_iter < SAMPLING_ITERATIONS; sampling_iter++) {
+
+					power_diff = factor_diff * evaluator.power_maps[sampling_iter][source_layer][x][y];
+
+					if (power_diff == 0.0) {
+						continue;
+					}
+
+					for (int layer = 0; layer < fp.getLayers(); layer++) {
+
+						std::array<double, ThermalAnalyzer::THERMAL_MASK_DIM> const& mask = masks[std::abs(layer - source_layer)];
+
+						// walk the thermal-map bins covered by the mask centered at the changed bin; the mask index relates to the offset of the
+						// changed bin from the thermal-map bin, see ThermalAnalyzer::performPowerBlurring
+						for (unsigned mask_x = 0; mask_x < ThermalAnalyzer::THERMAL_MASK_DIM; mask_x++) {
+
+							map_x = static_cast<int>(x + ThermalAnalyzer::THERMAL_MASK_CENTER - mask_x) - static_cast<int>(ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+
+							if (map_x < 0 || map_x >= static_cast<int>(ThermalAnalyzer::THERMAL_MAP_DIM)) {
+								continue;
+							}
+
+							for (unsigned mask_y = 0; mask_y < ThermalAnalyzer::THERMAL_MASK_DIM; mask_y++) {
+
+								map_y = static_cast<int>(y + ThermalAnalyzer::THERMAL_MASK_CENTER - mask_y) - static_cast<int>(ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+
+								if (map_y < 0 || map_y >= static_cast<int>(ThermalAnalyzer::THERMAL_MAP_DIM)) {
+									continue;
+								}
+
+								temp_samples[layer][map_x][map_y][sampling_iter] += power_diff * mask[mask_x] * mask[mask_y];
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return changed_bins;
+}
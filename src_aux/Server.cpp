@@ -0,0 +1,566 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Floorplan evaluation server; loads a benchmark once and answers
+ *    evaluate/optimize requests over a Unix domain socket or via stdin/stdout
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+#include "../src/ThermalAnalyzer.hpp"
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/// evaluation server; friend of FloorPlanner in order to evaluate given solutions on the
+/// loaded benchmark, to replicate the loaded configuration for SA runs, and to access
+/// the final results
+///
+/// protocol: line-based requests and responses; each response starts w/ ``ok'' or
+/// ``error MESSAGE'' and is terminated by ``end''
+///
+/// evaluate [maps]		followed by a Corblivar solution, terminated by ``end''
+/// optimize [seed N] [maps]	SA run, w/ solution as part of the response
+/// info			benchmark properties
+/// quit			close connection
+/// shutdown			stop server
+class Server {
+	private:
+		/// loaded benchmark; used for all evaluations
+		std::unique_ptr<FloorPlanner> fp;
+		/// loaded benchmark; used for all evaluations
+		std::unique_ptr<CorblivarCore> corb;
+
+		/// read one line, w/o line break; false for eof
+		static bool readLine(FILE* in, std::string& line) {
+			int c;
+
+			line.clear();
+
+			while ((c = std::fgetc(in)) != EOF) {
+
+				if (c == '\n') {
+					return true;
+				}
+				if (c != '\r') {
+					line += static_cast<char>(c);
+				}
+			}
+
+			return !line.empty();
+		}
+
+		/// sanity check of solutions, such that malformed requests do not
+		/// terminate the server in IO::parseCorblivarFile; all blocks have to
+		/// be covered exactly once, on valid dies
+		bool checkSolution(std::string const& solution, std::string& error) const {
+			std::istringstream in(solution);
+			std::string tmpstr, block_id;
+			std::vector<bool> blocks_parsed;
+			Block const* block;
+			int cur_layer;
+			unsigned dir, T, tuples;
+			double width, height;
+
+			blocks_parsed.assign(this->fp->getBlocks().size(), false);
+
+			while (tmpstr != "data_start" && in >> tmpstr);
+
+			if (tmpstr != "data_start") {
+				error = "solution w/o data_start";
+				return false;
+			}
+
+			cur_layer = -1;
+			tuples = 0;
+
+			while (in >> tmpstr) {
+
+				if (tmpstr == "CBL") {
+
+					if (!(in >> tmpstr >> cur_layer >> tmpstr) || cur_layer < 0 || cur_layer >= this->fp->getLayers()) {
+						error = "invalid die in solution; config is set for " + std::to_string(this->fp->getLayers()) + " dies";
+						return false;
+					}
+				}
+				else if (tmpstr == "tuple") {
+
+					// drop tuple id, ":", and "("
+					in >> tmpstr >> tmpstr >> tmpstr;
+
+					if (!(in >> block_id >> dir >> T >> width >> height >> tmpstr) || cur_layer == -1 || width <= 0.0 || height <= 0.0) {
+						error = "malformed tuple in solution for block " + block_id;
+						return false;
+					}
+
+					block = Block::findBlock(block_id, this->fp->getBlocks());
+					if (block == nullptr) {
+						error = "unknown block in solution: " + block_id;
+						return false;
+					}
+					if (blocks_parsed[block - this->fp->getBlocks().data()]) {
+						error = "block given twice in solution: " + block_id;
+						return false;
+					}
+
+					blocks_parsed[block - this->fp->getBlocks().data()] = true;
+					tuples++;
+				}
+			}
+
+			if (tuples != this->fp->getBlocks().size()) {
+				error = "solution covers " + std::to_string(tuples) + " blocks; benchmark has " + std::to_string(this->fp->getBlocks().size()) + " blocks";
+				return false;
+			}
+
+			return true;
+		}
+
+		/// final layout and evaluation, as in FloorPlanner::finalize, w/o output
+		/// files; the die outline is shrunk for the evaluation, as for the results
+		/// file of Corblivar, and restored afterwards, such that all requests
+		/// consider the same fixed outline
+		static void writeResult(FloorPlanner& fp, CorblivarCore& corb, bool const& overall_cost, bool const& maps, std::ostream& out) {
+			FloorPlanner::Cost cost;
+			decltype(fp.IC) IC_fixed;
+			bool valid;
+			unsigned x, y;
+
+			// apply best solution, if available, as final solution
+			valid = corb.applyBestCBLs(fp.logMin());
+			// generate final layout
+			fp.generateLayout(corb, fp.opt_flags.alignment);
+
+			out << "valid " << valid << std::endl;
+
+			// determine cost terms and overall cost; consider non-normalized,
+			// actual values
+			if (valid) {
+
+				// scale terminal pins to blocks outline, as for best solutions
+				// during SA; this way, evaluations are independent of previous
+				// requests
+				fp.scaleTerminalPins(fp.determBlocksOutline());
+
+				// shrink fixed outline considering the final layout, as in
+				// FloorPlanner::finalize; memorize fixed outline
+				IC_fixed = fp.IC;
+				if (fp.IC.outline_shrink) {
+					fp.shrinkDieOutlines();
+				}
+
+				cost = fp.evaluateLayout(corb.getAlignments(), 1.0, true, false, true);
+
+				// overall cost cannot be determined for evaluations since no
+				// normalization during SA search was performed
+				if (overall_cost) {
+					out << "cost " << cost.total_cost << std::endl;
+				}
+				out << "packing_overhead " << cost.area_actual_value << std::endl;
+				out << "deadspace " << 100.0 * (fp.IC.stack_deadspace / fp.IC.stack_area) << std::endl;
+				out << "outline " << fp.IC.outline_x << " " << fp.IC.outline_y << std::endl;
+				out << "HPWL " << cost.HPWL_actual_value << std::endl;
+				out << "TSVs " << cost.TSVs_actual_value << std::endl;
+				out << "power " << cost.power_blocks + cost.power_wires + cost.power_TSVs << std::endl;
+
+				if (fp.opt_flags.routing_util) {
+					out << "routing_util " << cost.routing_util_actual_value << std::endl;
+				}
+				if (fp.opt_flags.thermal) {
+					out << "thermal " << cost.thermal_actual_value << std::endl;
+				}
+				if (fp.opt_flags.alignment) {
+					out << "alignments " << cost.alignments_actual_value << std::endl;
+				}
+				if (fp.opt_flags.timing || fp.opt_flags.voltage_assignment) {
+					out << "timing " << cost.timing_actual_value << std::endl;
+				}
+			}
+
+			out << "blocks " << fp.getBlocks().size() << std::endl;
+			for (Block const& block : fp.getBlocks()) {
+				out << block.id << " " << block.layer << " " << block.bb.ll.x << " " << block.bb.ll.y << " " << block.bb.w << " " << block.bb.h << std::endl;
+			}
+
+			// maps are only available after thermal analysis; one line per
+			// x-index, w/ values for all y-indices
+			if (maps && valid && fp.opt_flags.thermal && fp.thermal_analysis.thermal_map != nullptr) {
+
+				out << "thermal_map " << ThermalAnalyzer::THERMAL_MAP_DIM << " " << ThermalAnalyzer::THERMAL_MAP_DIM << std::endl;
+				for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+					for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+						out << (*fp.thermal_analysis.thermal_map)[x][y].temp << (y + 1 < ThermalAnalyzer::THERMAL_MAP_DIM ? " " : "\n");
+					}
+				}
+
+				for (int i = 0; i < fp.getLayers(); i++) {
+
+					out << "power_map " << i << " " << ThermalAnalyzer::THERMAL_MAP_DIM << " " << ThermalAnalyzer::THERMAL_MAP_DIM << std::endl;
+					for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+						for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+							out << fp.thermalAnalyzer.getPowerMapsOrig()[i][x][y].power_density << (y + 1 < ThermalAnalyzer::THERMAL_MAP_DIM ? " " : "\n");
+						}
+					}
+				}
+			}
+
+			// restore fixed outline for further requests, along w/ the maps
+			// re-targeted by FloorPlanner::shrinkDieOutlines; the terminal pins
+			// are scaled again for each evaluation
+			if (valid && fp.IC.outline_shrink) {
+				fp.IC = IC_fixed;
+				fp.thermalAnalyzer.scalePowerMaps(fp.getOutline());
+				fp.routingUtil.scaleUtilMaps(fp.getOutline());
+			}
+		}
+
+	public:
+		/// named parameters which are not supported; they refer to further
+		/// files which would alter the solutions to be evaluated
+		static bool unsupportedOption(std::string const& option) {
+			return (option == "--warm-start" || option == "--resume");
+		}
+
+		/// load benchmark; same sequence as in main() of Corblivar, for
+		/// regular runs
+		void load(int const& argc, char** argv) {
+
+			this->fp.reset(new FloorPlanner());
+			FloorPlanner& fp = *this->fp;
+
+			IO::parseParametersFiles(fp, argc, argv);
+
+			// parse blocks
+			IO::parseBlocks(fp);
+			// parse nets
+			IO::parseNets(fp);
+
+			// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+			fp.initTimingPowerAnalyser();
+
+			// init Corblivar core
+			this->corb.reset(new CorblivarCore(fp.getLayers(), fp.getBlocks().size()));
+
+			// parse alignment request
+			IO::parseAlignmentRequests(fp, this->corb->editAlignments());
+
+			// init thermal analyzer, only reasonable after parsing config file
+			fp.initThermalAnalyzer();
+
+			// init routing-utilization analyzer
+			fp.initRoutingUtilAnalyzer();
+		}
+
+		/// evaluate given solution on the loaded benchmark
+		void evaluate(std::string const& solution, bool const& maps, std::ostream& out) {
+			std::istringstream solution_in(solution);
+			std::string error;
+
+			if (!this->checkSolution(solution, error)) {
+				out << "error " << error << std::endl;
+				return;
+			}
+
+			// reset CBLs of previous evaluations
+			for (int d = 0; d < this->fp->getLayers(); d++) {
+				this->corb->editDie(d).editCBL().clear();
+			}
+
+			IO::parseCorblivarFile(*this->fp, *this->corb, solution_in);
+
+			// assume read in data as best solution
+			this->corb->storeBestCBLs();
+
+			out << "ok" << std::endl;
+			Server::writeResult(*this->fp, *this->corb, false, maps, out);
+		}
+
+		/// SA run on a replica of the loaded benchmark, such that the loaded
+		/// benchmark remains as is for further evaluations
+		void optimize(unsigned const& seed, bool const& maps, std::ostream& out) {
+			std::unique_ptr<FloorPlanner> replica;
+
+			replica.reset(new FloorPlanner());
+			FloorPlanner& fp = *replica;
+			FloorPlanner const& setup = *this->fp;
+
+			// replicate the configuration
+			fp.replicateConfig(setup);
+			fp.schedule.fixed_seed = true;
+			fp.schedule.seed = seed;
+
+			// the floorplanner seeds the random-number generator by time;
+			// seed only now, and consider the runtime only from now on
+			Math::seed(seed);
+			fp.time_start = std::chrono::steady_clock::now();
+
+			// parse blocks
+			IO::parseBlocks(fp);
+			// parse nets
+			IO::parseNets(fp);
+
+			// generate DAG (directed acyclic graph) for SL-STA (system-level static timing analysis)
+			fp.initTimingPowerAnalyser();
+
+			// init Corblivar core
+			CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+			// parse alignment request
+			IO::parseAlignmentRequests(fp, corb.editAlignments());
+
+			// init thermal analyzer, only reasonable after parsing config file
+			fp.initThermalAnalyzer();
+
+			// init routing-utilization analyzer
+			fp.initRoutingUtilAnalyzer();
+
+			// generate new data set
+			fp.initCorblivar(corb);
+
+			// perform SA; main handler, covers multilevel and flat SA
+			fp.performMultilevelSA(corb);
+
+			out << "ok" << std::endl;
+			out << "seed " << seed << std::endl;
+			out << "runtime " << fp.SA_stats.SA_runtime << std::endl;
+			Server::writeResult(fp, corb, true, maps, out);
+
+			out << "solution" << std::endl;
+			out << corb.CBLsString();
+			out << "end_solution" << std::endl;
+		}
+
+		/// benchmark properties
+		void info(std::ostream& out) const {
+
+			out << "ok" << std::endl;
+			out << "benchmark " << this->fp->benchmark << std::endl;
+			out << "blocks " << this->fp->getBlocks().size() << std::endl;
+			out << "dies " << this->fp->getLayers() << std::endl;
+			out << "outline " << this->fp->IC.outline_x << " " << this->fp->IC.outline_y << std::endl;
+			out << "outline_shrink " << this->fp->IC.outline_shrink << std::endl;
+			out << "thermal " << this->fp->opt_flags.thermal << std::endl;
+		}
+
+		/// handle requests of one client; false for shutdown request
+		bool serve(FILE* in, FILE* out) {
+			std::string line, request, tmpstr, solution;
+			bool maps, valid_args;
+			unsigned seed;
+
+			while (Server::readLine(in, line)) {
+				std::istringstream tokens(line);
+				std::stringstream response;
+
+				// full precision of all values
+				response << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+				// skip empty lines
+				if (!(tokens >> request)) {
+					continue;
+				}
+
+				if (request == "quit") {
+					return true;
+				}
+				else if (request == "shutdown") {
+					return false;
+				}
+
+				maps = false;
+				valid_args = true;
+				seed = this->fp->schedule.fixed_seed ? this->fp->schedule.seed : static_cast<unsigned>(time(0));
+
+				while (tokens >> tmpstr) {
+
+					if (tmpstr == "maps") {
+						maps = true;
+					}
+					else if (tmpstr == "seed" && tokens >> tmpstr && std::all_of(tmpstr.begin(), tmpstr.end(), ::isdigit)) {
+						seed = std::stoul(tmpstr);
+					}
+					else {
+						valid_args = false;
+					}
+				}
+
+				if (request == "evaluate") {
+
+					// solution, terminated by ``end''
+					solution.clear();
+					while (Server::readLine(in, line) && line != "end") {
+						solution += line + "\n";
+					}
+
+					if (valid_args) {
+						this->evaluate(solution, maps, response);
+					}
+					else {
+						response << "error invalid arguments: " << line << std::endl;
+					}
+				}
+				else if (!valid_args) {
+					response << "error invalid arguments: " << line << std::endl;
+				}
+				else if (request == "optimize") {
+					this->optimize(seed, maps, response);
+				}
+				else if (request == "info") {
+					this->info(response);
+				}
+				else {
+					response << "error unknown request: " << request << std::endl;
+				}
+
+				response << "end" << std::endl;
+
+				std::fputs(response.str().c_str(), out);
+				std::fflush(out);
+			}
+
+			return true;
+		}
+};
+
+int main (int argc, char** argv) {
+	Server server;
+	std::string socket_file;
+	std::vector<char*> args;
+	unsigned positional;
+	FILE* in;
+	FILE* out;
+	int sock, conn;
+	struct sockaddr_un addr;
+
+	std::cout << std::endl;
+	std::cout << "Corblivar evaluation server" << std::endl;
+	std::cout << "---------------------------" << std::endl;
+	std::cout << std::endl;
+
+	// arguments for IO::parseParametersFiles, i.e., all but the socket file; only the
+	// mandatory positional parameters are reasonable
+	args.push_back(argv[0]);
+	positional = 0;
+	for (int i = 2; i < argc; i++) {
+
+		args.push_back(argv[i]);
+
+		if (std::string(argv[i]).compare(0, 2, "--") == 0) {
+
+			if (Server::unsupportedOption(argv[i])) {
+				std::cout << "Server> Named parameter not supported: " << argv[i] << std::endl;
+				exit(1);
+			}
+
+			if (i + 1 < argc) {
+				args.push_back(argv[++i]);
+			}
+		}
+		else {
+			positional++;
+		}
+	}
+
+	if (argc < 2 || positional != 3) {
+		std::cout << "Server> Usage: " << argv[0] << " socket_file benchmark_name config_file benchmarks_dir [--name value ...]" << std::endl;
+		std::cout << "Server> " << std::endl;
+		std::cout << "Server> Mandatory parameter ``socket_file'': Unix domain socket to listen on; ``-'' for requests via stdin and responses via stdout, then logging goes to stderr" << std::endl;
+		std::cout << "Server> Further parameters: same as for Corblivar, except for solution file, TSV density, and named parameters handling further solutions" << std::endl;
+		std::cout << "Server> " << std::endl;
+		std::cout << "Server> Requests, one per line: ``evaluate [maps]'' followed by a Corblivar solution and ``end''; ``optimize [seed N] [maps]''; ``info''; ``quit''; ``shutdown''" << std::endl;
+		std::cout << "Server>  Responses: ``ok'' or ``error MESSAGE'', followed by cost terms, blocks, and optionally thermal and power maps, terminated by ``end''" << std::endl;
+
+		exit(1);
+	}
+
+	socket_file = argv[1];
+
+	// stdin/stdout protocol; responses go to the original stdout, all logging to
+	// stderr
+	if (socket_file == "-") {
+
+		std::cout.flush();
+
+		in = stdin;
+		out = fdopen(dup(STDOUT_FILENO), "w");
+		dup2(STDERR_FILENO, STDOUT_FILENO);
+
+		server.load(args.size(), args.data());
+		server.serve(in, out);
+
+		std::fclose(out);
+
+		return 0;
+	}
+
+	// Unix domain socket; clients are served one after another
+	if (socket_file.size() >= sizeof(addr.sun_path)) {
+		std::cout << "Server> Socket file name too long: " << socket_file << std::endl;
+		exit(1);
+	}
+
+	server.load(args.size(), args.data());
+
+	// clients closing their connection early shall not terminate the server
+	std::signal(SIGPIPE, SIG_IGN);
+
+	sock = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	std::memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	std::strncpy(addr.sun_path, socket_file.c_str(), sizeof(addr.sun_path) - 1);
+
+	unlink(socket_file.c_str());
+	if (sock < 0 || bind(sock, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0 || listen(sock, 8) < 0) {
+		std::cout << "Server> Cannot listen on socket file: " << socket_file << std::endl;
+		exit(1);
+	}
+
+	std::cout << std::endl;
+	std::cout << "Server> Listening on socket file: " << socket_file << std::endl;
+	std::cout << std::endl;
+
+	while ((conn = accept(sock, nullptr, nullptr)) >= 0) {
+
+		in = fdopen(conn, "r");
+		out = fdopen(dup(conn), "w");
+
+		if (!server.serve(in, out)) {
+			std::fclose(in);
+			std::fclose(out);
+			break;
+		}
+
+		std::fclose(in);
+		std::fclose(out);
+	}
+
+	close(sock);
+	unlink(socket_file.c_str());
+
+	std::cout << "Server> Shutdown" << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Client for the floorplan evaluation server; forwards requests to the
+ *    server socket and prints the responses, for testing and scripting
+ *
+ *    Copyright (C) 2013-2016 Johann Knechtel, johann aett jknechtel dot de
+ *
+ *    This file is part of Corblivar.
+ *
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/Corblivar.incl.hpp"
+#include <cstdio>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+int main (int argc, char** argv) {
+	std::string socket_file;
+	FILE* requests;
+	int sock;
+	struct sockaddr_un addr;
+	char buffer[4096];
+	ssize_t size;
+
+	if (argc < 2) {
+		std::cout << "Server_Client> Usage: " << argv[0] << " socket_file [requests_file]" << std::endl;
+		std::cout << "Server_Client> " << std::endl;
+		std::cout << "Server_Client> Mandatory parameter ``socket_file'': Unix domain socket of running Server" << std::endl;
+		std::cout << "Server_Client> Optional parameter ``requests_file'': requests to be sent, see Server; default: stdin" << std::endl;
+		std::cout << "Server_Client>  All responses are printed to stdout" << std::endl;
+
+		exit(1);
+	}
+
+	socket_file = argv[1];
+
+	if (argc > 2) {
+		requests = std::fopen(argv[2], "r");
+
+		if (requests == nullptr) {
+			std::cout << "Server_Client> No such requests file: " << argv[2] << std::endl;
+			exit(1);
+		}
+	}
+	else {
+		requests = stdin;
+	}
+
+	if (socket_file.size() >= sizeof(addr.sun_path)) {
+		std::cout << "Server_Client> Socket file name too long: " << socket_file << std::endl;
+		exit(1);
+	}
+
+	sock = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	std::memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	std::strncpy(addr.sun_path, socket_file.c_str(), sizeof(addr.sun_path) - 1);
+
+	if (sock < 0 || connect(sock, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+		std::cout << "Server_Client> Cannot connect to socket file: " << socket_file << std::endl;
+		exit(1);
+	}
+
+	// send requests in separate thread, such that large responses cannot block the
+	// server while further requests are pending; the end of the requests is signaled
+	// by closing the sending side of the connection
+	std::thread sender([&]() {
+		char buffer[4096];
+		size_t size, sent;
+		ssize_t ret;
+
+		while ((size = std::fread(buffer, 1, sizeof(buffer), requests)) > 0) {
+
+			for (sent = 0; sent < size; sent += ret) {
+
+				ret = send(sock, buffer + sent, size - sent, MSG_NOSIGNAL);
+				if (ret < 0) {
+					break;
+				}
+			}
+			if (sent < size) {
+				break;
+			}
+		}
+
+		shutdown(sock, SHUT_WR);
+	});
+
+	// print responses until server closes connection
+	while ((size = recv(sock, buffer, sizeof(buffer), 0)) > 0) {
+		std::fwrite(buffer, 1, size, stdout);
+	}
+	std::fflush(stdout);
+
+	sender.join();
+
+	close(sock);
+	if (requests != stdin) {
+		std::fclose(requests);
+	}
+
+	return 0;
+}